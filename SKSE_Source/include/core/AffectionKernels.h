@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace MARAS::AffectionKernels {
+
+    // Batch math for the affection apply and decay passes, run over whole columns of the AffectionStore instead of
+    // one NPC at a time. Each kernel has a scalar reference and an SSE2 path (baseline on x64, so no runtime
+    // dispatch). The two paths perform the same float operations in the same order and give bit-identical results.
+    // Dispatching entry points pick the SSE2 path when it is available.
+
+    inline constexpr std::size_t kTypeCount = 16;
+
+    // Daily amounts are limited to this magnitude before rounding, which keeps every rounded value and the
+    // per-row sum inside int range
+    inline constexpr float kMaxDailyMagnitude = 1.0e6f;
+
+    // Per-type clamp applied after rounding; unconfigured types use the full int range
+    struct TypeBounds {
+        std::array<std::int32_t, kTypeCount> minVal;
+        std::array<std::int32_t, kTypeCount> maxVal;
+    };
+
+    // Daily delta per row: sum over the types set in touched[row] of clamp(round-half-away(amount)).
+    // `amounts` holds kTypeCount floats per row; out.size() rows are computed.
+    void DailyDeltas(std::span<const float> amounts, std::span<const std::uint16_t> touched, const TypeBounds& bounds,
+                     std::span<std::int32_t> out);
+    void DailyDeltasScalar(std::span<const float> amounts, std::span<const std::uint16_t> touched,
+                           const TypeBounds& bounds, std::span<std::int32_t> out);
+
+    // The same limit, rounding and clamp for a single amount, for types beyond the kTypeCount kernel columns
+    std::int32_t TypeDelta(float amount, std::int32_t minVal, std::int32_t maxVal);
+
+    // Loneliness decay inputs shared by one pass
+    struct DecayParams {
+        std::array<float, 8> perDayByTemperament{};  // indexed by Temperament; out-of-range uses defaultPerDay
+        float defaultPerDay = 0.0f;
+        float spouseMultiplier = 1.0f;
+        float engagedMultiplier = 1.0f;
+        float decayMultiplier = 1.0f;
+        float followingBonus = 0.0f;
+        float daysBeforeDecay = 0.0f;
+    };
+
+    // Per-NPC decay flags
+    inline constexpr std::uint8_t kDecayLonely = 1 << 0;     // married or engaged: subject to loneliness decay
+    inline constexpr std::uint8_t kDecayEngaged = 1 << 1;    // engaged: decays at engagedMultiplier
+    inline constexpr std::uint8_t kDecayFollowing = 1 << 2;  // player teammate: gains followingBonus instead
+
+    // Loneliness affection per NPC: 0 until more than daysBeforeDecay days without affection (or when the decay
+    // multiplier is 0), then followingBonus for followers, else -(perDay * spouse * engaged * decay) for lonely NPCs.
+    void LonelinessDecay(std::span<const float> daysSince, std::span<const std::uint8_t> temperament,
+                         std::span<const std::uint8_t> flags, const DecayParams& params, std::span<float> out);
+    void LonelinessDecayScalar(std::span<const float> daysSince, std::span<const std::uint8_t> temperament,
+                               std::span<const std::uint8_t> flags, const DecayParams& params, std::span<float> out);
+
+}  // namespace MARAS::AffectionKernels
@@ -1,29 +1,133 @@
 #pragma once
 
+#include <array>
+#include <chrono>
 #include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
 #include <string>
+#include <string_view>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
+#include "core/AffectionKernels.h"
 #include "core/Serialization.h"
 
 namespace MARAS {
 
+    // Per-NPC affection state in struct-of-arrays form. Rows are addressed by the NPC's NPCRoster slot, so an NPC's
+    // relationship record and affection row share one index and the apply/decay passes are linear walks over the
+    // columns. Daily amounts are stored kTypeCount floats per row, contiguously; amounts for type IDs past
+    // kTypeCount go to a small per-row spill list instead. Each row remembers which NPC it belongs to; a roster
+    // slot that is handed to a different NPC starts with a clean row.
+    class AffectionStore {
+    public:
+        static constexpr std::size_t kTypeCount = AffectionKernels::kTypeCount;
+        static constexpr float kNeverRecorded = -1.0f;  // lastDay of a row that never received affection
+
+        // Claim row `slot` for npcFormID, resetting it if it held another NPC's data
+        void Bind(std::uint32_t slot, RE::FormID npcFormID);
+        bool Holds(std::uint32_t slot, RE::FormID npcFormID) const {
+            return npcFormID != 0 && slot < owner_.size() && owner_[slot] == npcFormID;
+        }
+        void Reset(std::uint32_t row);
+        void Clear();
+
+        std::size_t RowCount() const { return owner_.size(); }
+        RE::FormID Owner(std::uint32_t row) const { return owner_[row]; }
+
+        bool HasPermanent(std::uint32_t row) const { return hasPermanent_[row] != 0; }
+        int Permanent(std::uint32_t row) const { return hasPermanent_[row] ? permanent_[row] : 0; }
+        void SetPermanent(std::uint32_t row, int value) {
+            permanent_[row] = value;
+            hasPermanent_[row] = 1;
+        }
+
+        // Value last pushed to the affection faction and threshold events, and whether Permanent() changed since
+        int Published(std::uint32_t row) const { return published_[row]; }
+        bool IsDirty(std::uint32_t row) const { return dirty_[row] != 0; }
+        // Returns true if the row was clean before
+        bool MarkDirty(std::uint32_t row) {
+            const bool wasClean = dirty_[row] == 0;
+            dirty_[row] = 1;
+            return wasClean;
+        }
+        void Publish(std::uint32_t row) {
+            published_[row] = Permanent(row);
+            dirty_[row] = 0;
+        }
+
+        float LastDay(std::uint32_t row) const { return lastDay_[row]; }
+        void SetLastDay(std::uint32_t row, float day) { lastDay_[row] = day; }
+
+        // Daily amounts by type ID; `touched` marks the types that received affection since the last apply
+        std::span<float, kTypeCount> Daily(std::uint32_t row) {
+            return std::span<float, kTypeCount>(daily_.data() + std::size_t{row} * kTypeCount, kTypeCount);
+        }
+        std::span<const float, kTypeCount> Daily(std::uint32_t row) const {
+            return std::span<const float, kTypeCount>(daily_.data() + std::size_t{row} * kTypeCount, kTypeCount);
+        }
+        std::uint16_t Touched(std::uint32_t row) const { return touched_[row]; }
+        void AddDaily(std::uint32_t row, std::size_t typeId, float amount);
+        void ClearDaily(std::uint32_t row);
+
+        // Daily amount of any type, including spilled ones
+        float DailyAmount(std::uint32_t row, std::size_t typeId) const;
+
+        // Spilled daily amounts (type ID >= kTypeCount) of a row, or nullptr if it has none
+        using SpillList = std::vector<std::pair<std::uint16_t, float>>;
+        const SpillList* Spill(std::uint32_t row) const;
+
+        // Whole columns, for the batch kernels
+        std::span<const float> DailyColumn() const { return daily_; }
+        std::span<const std::uint16_t> TouchedColumn() const { return touched_; }
+
+    private:
+        std::vector<RE::FormID> owner_;  // 0 = unused row
+        std::vector<std::int32_t> permanent_;
+        std::vector<std::uint8_t> hasPermanent_;
+        std::vector<std::int32_t> published_;
+        std::vector<std::uint8_t> dirty_;
+        std::vector<float> lastDay_;
+        std::vector<std::uint16_t> touched_;
+        std::vector<float> daily_;  // RowCount() * kTypeCount
+        std::unordered_map<std::uint32_t, SpillList> spill_;  // by row; only rows with spilled amounts
+    };
+    static_assert(AffectionStore::kTypeCount <= 16, "AffectionStore touched mask holds one bit per type");
+
     class AffectionService {
     public:
         using FormID = RE::FormID;
 
+        // Affection types ("gift", "intimacy", ...) are interned case-insensitively to small IDs on first use.
+        // IDs are stable for the lifetime of the process. The first kKernelAffectionTypes types get store columns
+        // and the batch kernels; any further types (addon mods may add their own) take the scalar spill path.
+        using AffectionTypeId = std::uint16_t;
+        static constexpr std::size_t kKernelAffectionTypes = AffectionStore::kTypeCount;
+        static constexpr AffectionTypeId kInvalidAffectionType = 0xFFFF;
+
         static AffectionService& GetSingleton();
 
         // Daily accumulation (called from Papyrus)
         void AddAffection(FormID npcFormID, float amount, const std::string& type);
         float GetDailyAffection(FormID npcFormID, const std::string& type) const;
 
-        // Permanent accessors
+        // Permanent accessors. For a registered NPC a write only updates the stored value, which
+        // GetPermanentAffection returns at once; the affection faction rank and the maras_change_affection event
+        // follow on the next FlushAffectionChanges, i.e. the next unpaused frame. Until then the faction rank
+        // (and a Papyrus GetFactionRank on it) still reads the old value.
         int GetPermanentAffection(FormID npcFormID) const;
         void SetPermanentAffection(FormID npcFormID, int amount);
 
+        // Register the persistent FrameScheduler job that runs FlushAffectionChanges. Call once at startup.
+        void ScheduleJobs();
+
+        // Push pending affection changes: one faction rank write per changed NPC, and one event carrying the
+        // aggregate delta if the NPC ended up in a different threshold. Runs every scheduler tick of the job
+        // registered by ScheduleJobs and returns at once when nothing is pending.
+        void FlushAffectionChanges();
+
         // Min/Max per-type clamp configuration
         void SetAffectionMinMax(const std::string& type, int minVal, int maxVal);
         bool HasMinMaxForType(const std::string& type) const;
@@ -48,12 +152,20 @@ namespace MARAS {
         void RecordAffectionInteraction(FormID npcFormID);
         float GetDaysSinceLastAffection(FormID npcFormID) const;
 
-        // Handle day change event for decay logic
-        void OnDayChanged();
+        // Handle day change event for decay logic. Inputs are snapshotted here and NPCs are processed in small
+        // slices on FrameScheduler; onComplete runs after the last slice.
+        void OnDayChanged(std::function<void()> onComplete = {});
+
+        // Run the rest of an in-flight decay pass at once, including its onComplete. Called before saving so a
+        // save never holds a partially decayed roster.
+        void FinishPendingDecay();
 
         // Remove all data for a specific NPC (called when NPC is unregistered)
         void RemoveNPCData(FormID npcFormID);
 
+        // Move affection kept for a not-yet-registered NPC into its roster row (called when the NPC is registered)
+        void AdoptNPCData(FormID npcFormID);
+
         // Decay multiplier configuration
         void SetDecayMultiplier(float multiplier);
         float GetDecayMultiplier() const;
@@ -61,30 +173,92 @@ namespace MARAS {
     private:
         AffectionService() = default;
 
+        // In-flight day-change decay pass. Values shared by every NPC are captured when the day changes.
+        struct DecayPass {
+            bool active = false;
+            float currentDay = 0.0f;
+            AffectionKernels::DecayParams params;
+            std::size_t slotCount = 0;  // roster slots at pass start; slots are walked in order
+            std::size_t next = 0;
+            std::size_t visited = 0;
+            std::size_t applied = 0;
+            std::uint32_t slices = 0;
+            std::chrono::microseconds busy{0};
+            std::chrono::steady_clock::time_point started;
+            std::function<void()> onComplete;
+        };
+
+        // Affection of an NPC without a roster row (not registered, or registered only later), keyed by FormID.
+        // Writes are published immediately; daily amounts wait for the NPC to be registered.
+        struct UnboundAffection {
+            bool hasPermanent = false;
+            int permanent = 0;
+            float lastDay = AffectionStore::kNeverRecorded;
+            std::vector<std::pair<AffectionTypeId, float>> daily;
+        };
+
+        struct TypeClamp {
+            bool set = false;
+            int minVal = 0;
+            int maxVal = 0;
+        };
+
+        // Case-insensitive hashing so type names can be looked up without building a lowercased copy
+        struct TypeNameHash {
+            using is_transparent = void;
+            std::size_t operator()(std::string_view name) const noexcept;
+        };
+        struct TypeNameEqual {
+            using is_transparent = void;
+            bool operator()(std::string_view a, std::string_view b) const noexcept;
+        };
+
+        // Type registry. FindType checks the last resolved name first: Papyrus callers usually repeat a type.
+        AffectionTypeId InternType(std::string_view type);
+        AffectionTypeId FindType(std::string_view type) const;
+        void AddAffectionById(FormID npcFormID, float amount, AffectionTypeId typeId);
+
+        // Store row for a registered NPC (its roster slot), or kNoRow. FindRow only returns rows already bound to
+        // the NPC; BindRow claims the row on first use.
+        static constexpr std::uint32_t kNoRow = std::numeric_limits<std::uint32_t>::max();
+        std::uint32_t FindRow(FormID npcFormID) const;
+        std::uint32_t BindRow(FormID npcFormID);
+
+        // Process up to maxCount NPCs of the current pass; returns true once the pass has finished
+        bool RunDecaySlice(std::size_t maxCount);
+        void FinishDecayPass();
+
         // Helper methods
         static RE::Actor* ValidateActor(FormID formID, const char* context);
-        static std::string NormalizeType(const std::string& type);
         static std::string GetAffectionThreshold(int affectionValue);
         static int ClampAffection(int value);
         void UpdateAffectionFaction(RE::Actor* actor, FormID npcFormID, int affectionValue);
         void SendAffectionChangeEvent(FormID npcFormID, const std::string& threshold, int delta);
-        int CalculateTotalDailyDelta(const std::unordered_map<std::string, float>& dailyByType) const;
-        float CalculateLonelinessDecay(FormID npcFormID, bool isFollowing) const;
+        AffectionKernels::TypeBounds BuildTypeBounds() const;
+        std::int32_t SpillDelta(std::uint32_t row) const;
+        AffectionKernels::DecayParams BuildDecayParams(std::size_t spouseCount) const;
+        static float SpouseCountDecayMultiplier(std::size_t spouseCount);
 
-        // permanent affection per NPC
-        std::unordered_map<FormID, int> permanentAffection_;
+        // permanent, last-affection day and daily affection per registered NPC
+        AffectionStore store_;
+        std::unordered_map<FormID, UnboundAffection> unbound_;
 
-        // daily affection per NPC -> type -> amount
-        std::unordered_map<FormID, std::unordered_map<std::string, float>> dailyAffection_;
+        // rows with unpublished permanent changes, in first-changed order (may hold rows reset since)
+        std::vector<std::uint32_t> dirtyRows_;
 
-        // per-type min/max clamp settings (type -> {min, max})
-        std::unordered_map<std::string, std::pair<int, int>> minMaxByType_;
+        // interned type names (index = type ID) and the reverse lookup
+        std::vector<std::string> typeNames_;
+        std::unordered_map<std::string, AffectionTypeId, TypeNameHash, TypeNameEqual> typeIds_;
+        mutable std::string lastTypeName_;
+        mutable AffectionTypeId lastTypeId_ = kInvalidAffectionType;
 
-        // Track last game day when NPC received affection
-        std::unordered_map<FormID, float> lastAffectionDay_;
+        // per-type min/max clamp settings, by type ID (one entry per interned type)
+        std::vector<TypeClamp> clampByType_;
 
         // Decay multiplier (0.0 = disabled, 1.0 = default, 2.0 = double)
         float decayMultiplier_ = 1.0f;
+
+        DecayPass decayPass_;
     };
 
 }  // namespace MARAS
@@ -1,12 +1,18 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <iomanip>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <typeinfo>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "RE/Skyrim.h"
 #include "utils/FormUtils.h"
@@ -17,108 +23,172 @@ namespace MARAS {
     public:
         static FormCache& GetSingleton();
 
+        // Resolve every form in the manifest (FormCache.cpp) in one pass and log the ones that are missing. Call
+        // once at kDataLoaded, before anything reads the cache; getters return nullptr until then. The table is
+        // not written afterwards, so getters are plain loads with no locking.
+        void WarmUp();
+
         // NOTE: explicit getters are preferred. Keep any plugin form ids
-        // centralized here and cached by named getters below.
+        // centralized in the manifest and exposed by named getters below.
 
         // Faction getters
-        RE::TESFaction* GetTrackedFaction();
-        RE::TESFaction* GetSpouseSocialClassFaction();
-        RE::TESFaction* GetSpouseSkillTypeFaction();
-        RE::TESFaction* GetSpouseTemperamentFaction();
-        RE::TESFaction* GetSpouseHousedFaction();
-        RE::TESFaction* GetHierarchyFaction();
-        RE::TESFaction* GetAffectionFaction();
+        RE::TESFaction* GetTrackedFaction() const { return Get<RE::TESFaction>(Slot::TrackedFaction); }
+        RE::TESFaction* GetSpouseSocialClassFaction() const {
+            return Get<RE::TESFaction>(Slot::SpouseSocialClassFaction);
+        }
+        RE::TESFaction* GetSpouseSkillTypeFaction() const { return Get<RE::TESFaction>(Slot::SpouseSkillTypeFaction); }
+        RE::TESFaction* GetSpouseTemperamentFaction() const {
+            return Get<RE::TESFaction>(Slot::SpouseTemperamentFaction);
+        }
+        RE::TESFaction* GetSpouseHousedFaction() const { return Get<RE::TESFaction>(Slot::SpouseHousedFaction); }
+        RE::TESFaction* GetHierarchyFaction() const { return Get<RE::TESFaction>(Slot::HierarchyFaction); }
+        RE::TESFaction* GetAffectionFaction() const { return Get<RE::TESFaction>(Slot::AffectionFaction); }
 
         // Marriage-related faction getters
-        RE::TESFaction* GetMarriagePotentialFaction();
-        RE::TESFaction* GetMarriageAskedFaction();
-        RE::TESFaction* GetCourtingFaction();
-        RE::TESFaction* GetPotentialHirelingFaction();
-        RE::TESFaction* GetMarriedFaction();
-        RE::TESFaction* GetPlayerBedOwnershipFaction();
+        RE::TESFaction* GetMarriagePotentialFaction() const {
+            return Get<RE::TESFaction>(Slot::MarriagePotentialFaction);
+        }
+        RE::TESFaction* GetMarriageAskedFaction() const { return Get<RE::TESFaction>(Slot::MarriageAskedFaction); }
+        RE::TESFaction* GetCourtingFaction() const { return Get<RE::TESFaction>(Slot::CourtingFaction); }
+        RE::TESFaction* GetPotentialHirelingFaction() const {
+            return Get<RE::TESFaction>(Slot::PotentialHirelingFaction);
+        }
+        RE::TESFaction* GetMarriedFaction() const { return Get<RE::TESFaction>(Slot::MarriedFaction); }
+        RE::TESFaction* GetPlayerBedOwnershipFaction() const {
+            return Get<RE::TESFaction>(Slot::PlayerBedOwnershipFaction);
+        }
 
         // FormList getters
-        RE::BGSListForm* GetRulerFactions();
-        RE::BGSListForm* GetNobleFactions();
-        RE::BGSListForm* GetReligiousFactions();
-        RE::BGSListForm* GetWealthyFactions();
-        RE::BGSListForm* GetMiddleFactions();
-        RE::BGSListForm* GetPovertyFactions();
-        RE::BGSListForm* GetOutcastFactions();
+        RE::BGSListForm* GetRulerFactions() const { return Get<RE::BGSListForm>(Slot::RulerFactions); }
+        RE::BGSListForm* GetNobleFactions() const { return Get<RE::BGSListForm>(Slot::NobleFactions); }
+        RE::BGSListForm* GetReligiousFactions() const { return Get<RE::BGSListForm>(Slot::ReligiousFactions); }
+        RE::BGSListForm* GetWealthyFactions() const { return Get<RE::BGSListForm>(Slot::WealthyFactions); }
+        RE::BGSListForm* GetMiddleFactions() const { return Get<RE::BGSListForm>(Slot::MiddleFactions); }
+        RE::BGSListForm* GetPovertyFactions() const { return Get<RE::BGSListForm>(Slot::PovertyFactions); }
+        RE::BGSListForm* GetOutcastFactions() const { return Get<RE::BGSListForm>(Slot::OutcastFactions); }
 
         // Class list getters
-        RE::BGSListForm* GetOratorClasses();
-        RE::BGSListForm* GetRangerClasses();
-        RE::BGSListForm* GetRogueClasses();
-        RE::BGSListForm* GetCraftsmanClasses();
-        RE::BGSListForm* GetMageClasses();
-        RE::BGSListForm* GetWarriorClasses();
+        RE::BGSListForm* GetOratorClasses() const { return Get<RE::BGSListForm>(Slot::OratorClasses); }
+        RE::BGSListForm* GetRangerClasses() const { return Get<RE::BGSListForm>(Slot::RangerClasses); }
+        RE::BGSListForm* GetRogueClasses() const { return Get<RE::BGSListForm>(Slot::RogueClasses); }
+        RE::BGSListForm* GetCraftsmanClasses() const { return Get<RE::BGSListForm>(Slot::CraftsmanClasses); }
+        RE::BGSListForm* GetMageClasses() const { return Get<RE::BGSListForm>(Slot::MageClasses); }
+        RE::BGSListForm* GetWarriorClasses() const { return Get<RE::BGSListForm>(Slot::WarriorClasses); }
+
+        // Form lists that support ContainsFast
+        enum class ListId : std::uint8_t {
+            RulerFactions,
+            NobleFactions,
+            ReligiousFactions,
+            WealthyFactions,
+            MiddleFactions,
+            PovertyFactions,
+            OutcastFactions,
+            OratorClasses,
+            RangerClasses,
+            RogueClasses,
+            CraftsmanClasses,
+            MageClasses,
+            WarriorClasses,
+            _Count
+        };
+        RE::BGSListForm* GetList(ListId id) const;
+
+        // Same answer as BGSListForm::HasForm (plugin and script-added entries), from a hash set built on first
+        // use. Lookups take no lock: a hit only compares the list's entry counts with the set's, and a miss also
+        // checks the list's stamp. The set is rebuilt when either changed, i.e. after scripts add, remove or revert
+        // entries. (Swapping one script-added entry for another between two lookups can leave one stale hit.)
+        bool ContainsFast(ListId id, RE::FormID formID);
+
+        // Cheap fingerprint of a form list's contents: plugin entries only change in number at runtime, while
+        // script-added entries are hashed by FormID
+        static std::uint64_t ListStamp(const RE::BGSListForm* list);
 
         // Keywords getters
-        RE::BGSKeyword* GetIgnoreProposeKeyword();
+        RE::BGSKeyword* GetIgnoreProposeKeyword() const { return Get<RE::BGSKeyword>(Slot::IgnoreProposeKeyword); }
 
         // Skyrim.esm faction getters
-        RE::TESFaction* GetPlayerFaction();
-        RE::TESFaction* GetCompanionsFaction();
-        RE::TESFaction* GetThievesFaction();
-        RE::TESFaction* GetBrotherhoodFaction();
-        RE::TESFaction* GetCollegeFaction();
-        RE::TESFaction* GetBardsFaction();
+        RE::TESFaction* GetPlayerFaction() const { return Get<RE::TESFaction>(Slot::PlayerFaction); }
+        RE::TESFaction* GetCompanionsFaction() const { return Get<RE::TESFaction>(Slot::CompanionsFaction); }
+        RE::TESFaction* GetThievesFaction() const { return Get<RE::TESFaction>(Slot::ThievesFaction); }
+        RE::TESFaction* GetBrotherhoodFaction() const { return Get<RE::TESFaction>(Slot::BrotherhoodFaction); }
+        RE::TESFaction* GetCollegeFaction() const { return Get<RE::TESFaction>(Slot::CollegeFaction); }
+        RE::TESFaction* GetBardsFaction() const { return Get<RE::TESFaction>(Slot::BardsFaction); }
 
         // Skyrim merchant factions
-        RE::TESFaction* GetMerchantFaction();
-        RE::TESFaction* GetApothecaryFaction();
-        RE::TESFaction* GetBlacksmithFaction();
-        RE::TESFaction* GetFletcherFaction();
-        RE::TESFaction* GetInnKeeperFaction();
-        RE::TESFaction* GetJewelerFaction();
-        RE::TESFaction* GetMiscFaction();
-        RE::TESFaction* GetSpellFaction();
-        RE::TESFaction* GetTailorFaction();
-        RE::TESFaction* GetHunterFaction();
+        RE::TESFaction* GetMerchantFaction() const { return Get<RE::TESFaction>(Slot::MerchantFaction); }
+        RE::TESFaction* GetApothecaryFaction() const { return Get<RE::TESFaction>(Slot::ApothecaryFaction); }
+        RE::TESFaction* GetBlacksmithFaction() const { return Get<RE::TESFaction>(Slot::BlacksmithFaction); }
+        RE::TESFaction* GetFletcherFaction() const { return Get<RE::TESFaction>(Slot::FletcherFaction); }
+        RE::TESFaction* GetInnKeeperFaction() const { return Get<RE::TESFaction>(Slot::InnKeeperFaction); }
+        RE::TESFaction* GetJewelerFaction() const { return Get<RE::TESFaction>(Slot::JewelerFaction); }
+        RE::TESFaction* GetMiscFaction() const { return Get<RE::TESFaction>(Slot::MiscFaction); }
+        RE::TESFaction* GetSpellFaction() const { return Get<RE::TESFaction>(Slot::SpellFaction); }
+        RE::TESFaction* GetTailorFaction() const { return Get<RE::TESFaction>(Slot::TailorFaction); }
+        RE::TESFaction* GetHunterFaction() const { return Get<RE::TESFaction>(Slot::HunterFaction); }
 
         // MARAS housed spouses merchant factions
-        RE::TESFaction* GetApothecaryMerchantHousedFaction();
-        RE::TESFaction* GetBlacksmithMerchantHousedFaction();
-        RE::TESFaction* GetFletcherMerchantHousedFaction();
-        RE::TESFaction* GetHunterMerchantHousedFaction();
-        RE::TESFaction* GetInnkeeperMerchantHousedFaction();
-        RE::TESFaction* GetJewelerMerchantHousedFaction();
-        RE::TESFaction* GetMiscMerchantHousedFaction();
-        RE::TESFaction* GetSpellsMerchantHousedFaction();
-        RE::TESFaction* GetTailorMerchantHousedFaction();
+        RE::TESFaction* GetApothecaryMerchantHousedFaction() const {
+            return Get<RE::TESFaction>(Slot::ApothecaryMerchantHousedFaction);
+        }
+        RE::TESFaction* GetBlacksmithMerchantHousedFaction() const {
+            return Get<RE::TESFaction>(Slot::BlacksmithMerchantHousedFaction);
+        }
+        RE::TESFaction* GetFletcherMerchantHousedFaction() const {
+            return Get<RE::TESFaction>(Slot::FletcherMerchantHousedFaction);
+        }
+        RE::TESFaction* GetHunterMerchantHousedFaction() const {
+            return Get<RE::TESFaction>(Slot::HunterMerchantHousedFaction);
+        }
+        RE::TESFaction* GetInnkeeperMerchantHousedFaction() const {
+            return Get<RE::TESFaction>(Slot::InnkeeperMerchantHousedFaction);
+        }
+        RE::TESFaction* GetJewelerMerchantHousedFaction() const {
+            return Get<RE::TESFaction>(Slot::JewelerMerchantHousedFaction);
+        }
+        RE::TESFaction* GetMiscMerchantHousedFaction() const {
+            return Get<RE::TESFaction>(Slot::MiscMerchantHousedFaction);
+        }
+        RE::TESFaction* GetSpellsMerchantHousedFaction() const {
+            return Get<RE::TESFaction>(Slot::SpellsMerchantHousedFaction);
+        }
+        RE::TESFaction* GetTailorMerchantHousedFaction() const {
+            return Get<RE::TESFaction>(Slot::TailorMerchantHousedFaction);
+        }
 
         // Skyrim.esm quest getters
-        RE::TESQuest* GetEastmarchThane();
-        RE::TESQuest* GetFalkreathThane();
-        RE::TESQuest* GetHaafingarThane();
-        RE::TESQuest* GetHjaalmarchThane();
-        RE::TESQuest* GetPaleThane();
-        RE::TESQuest* GetReachThane();
-        RE::TESQuest* GetRiftThane();
-        RE::TESQuest* GetWhiterunThane();
-        RE::TESQuest* GetWinterholdThane();
-
-        RE::TESQuest* GetCompanionsQuest();
-        RE::TESQuest* GetCollegeQuest();
-        RE::TESQuest* GetThievesQuest();
-        RE::TESQuest* GetBardsQuest();
-        RE::TESQuest* GetDragonbornQuest();
+        RE::TESQuest* GetEastmarchThane() const { return Get<RE::TESQuest>(Slot::EastmarchThane); }
+        RE::TESQuest* GetFalkreathThane() const { return Get<RE::TESQuest>(Slot::FalkreathThane); }
+        RE::TESQuest* GetHaafingarThane() const { return Get<RE::TESQuest>(Slot::HaafingarThane); }
+        RE::TESQuest* GetHjaalmarchThane() const { return Get<RE::TESQuest>(Slot::HjaalmarchThane); }
+        RE::TESQuest* GetPaleThane() const { return Get<RE::TESQuest>(Slot::PaleThane); }
+        RE::TESQuest* GetReachThane() const { return Get<RE::TESQuest>(Slot::ReachThane); }
+        RE::TESQuest* GetRiftThane() const { return Get<RE::TESQuest>(Slot::RiftThane); }
+        RE::TESQuest* GetWhiterunThane() const { return Get<RE::TESQuest>(Slot::WhiterunThane); }
+        RE::TESQuest* GetWinterholdThane() const { return Get<RE::TESQuest>(Slot::WinterholdThane); }
+
+        RE::TESQuest* GetCompanionsQuest() const { return Get<RE::TESQuest>(Slot::CompanionsQuest); }
+        RE::TESQuest* GetCollegeQuest() const { return Get<RE::TESQuest>(Slot::CollegeQuest); }
+        RE::TESQuest* GetThievesQuest() const { return Get<RE::TESQuest>(Slot::ThievesQuest); }
+        RE::TESQuest* GetBardsQuest() const { return Get<RE::TESQuest>(Slot::BardsQuest); }
+        RE::TESQuest* GetDragonbornQuest() const { return Get<RE::TESQuest>(Slot::DragonbornQuest); }
 
         // Global getters (TT_MARAS.esp)
-        RE::TESGlobal* GetLoveInterestsCount();
-        RE::TESGlobal* GetSpousesCount();
-        RE::TESGlobal* GetPlayerHousesCount();
+        RE::TESGlobal* GetLoveInterestsCount() const { return Get<RE::TESGlobal>(Slot::LoveInterestsCount); }
+        RE::TESGlobal* GetSpousesCount() const { return Get<RE::TESGlobal>(Slot::SpousesCount); }
+        RE::TESGlobal* GetPlayerHousesCount() const { return Get<RE::TESGlobal>(Slot::PlayerHousesCount); }
 
         // Special keyword getters
-        RE::BGSKeyword* GetClothingRichKeyword();
-        RE::BGSKeyword* GetHomeSandboxKeyword();
+        RE::BGSKeyword* GetClothingRichKeyword() const { return Get<RE::BGSKeyword>(Slot::ClothingRichKeyword); }
+        RE::BGSKeyword* GetHomeSandboxKeyword() const { return Get<RE::BGSKeyword>(Slot::HomeSandboxKeyword); }
 
         // Static object getters
-        RE::TESObjectSTAT* GetHomeSandboxMarkerStatic();
+        RE::TESObjectSTAT* GetHomeSandboxMarkerStatic() const {
+            return Get<RE::TESObjectSTAT>(Slot::HomeSandboxMarkerStatic);
+        }
 
         // Package getters
-        RE::TESPackage* GetHomeSandboxPackage();
+        RE::TESPackage* GetHomeSandboxPackage() const { return Get<RE::TESPackage>(Slot::HomeSandboxPackage); }
 
     private:
         FormCache() = default;
@@ -127,61 +197,110 @@ namespace MARAS {
         FormCache(const FormCache&) = delete;
         FormCache& operator=(const FormCache&) = delete;
 
-        // Cached pointers (initialized in .cpp lazily)
-        RE::TESFaction* trackedFaction_{nullptr};
-        RE::TESFaction* spouseSocialClassFaction_{nullptr};
-        RE::TESFaction* spouseSkillTypeFaction_{nullptr};
-        RE::TESFaction* spouseTemperamentFaction_{nullptr};
-        RE::TESFaction* spouseHousedFaction_{nullptr};
-        RE::TESFaction* hierarchyFaction_{nullptr};
-        RE::TESFaction* affectionFaction_{nullptr};
-
-        // Marriage-related factions
-        RE::TESFaction* marriagePotentialFaction_{nullptr};
-        RE::TESFaction* marriageAskedFaction_{nullptr};
-        RE::TESFaction* courtingFaction_{nullptr};
-        RE::TESFaction* potentialHirelingFaction_{nullptr};
-        RE::TESFaction* marriedFaction_{nullptr};
-        RE::TESFaction* playerBedOwnershipFaction_{nullptr};
-
-        RE::BGSListForm* rulerFactions_{nullptr};
-        RE::BGSListForm* nobleFactions_{nullptr};
-        RE::BGSListForm* religiousFactions_{nullptr};
-        RE::BGSListForm* wealthyFactions_{nullptr};
-        RE::BGSListForm* middleFactions_{nullptr};
-        RE::BGSListForm* povertyFactions_{nullptr};
-        RE::BGSListForm* outcastFactions_{nullptr};
-
-        RE::BGSListForm* oratorClasses_{nullptr};
-        RE::BGSListForm* rangerClasses_{nullptr};
-        RE::BGSListForm* rogueClasses_{nullptr};
-        RE::BGSListForm* craftsmanClasses_{nullptr};
-        RE::BGSListForm* mageClasses_{nullptr};
-        RE::BGSListForm* warriorClasses_{nullptr};
-
-        // MARAS housed merchant factions (cached)
-        RE::TESFaction* apothecaryHouseMerchantFaction_{nullptr};
-        RE::TESFaction* blacksmithHouseMerchantFaction_{nullptr};
-        RE::TESFaction* fletcherHouseMerchantFaction_{nullptr};
-        RE::TESFaction* hunterHouseMerchantFaction_{nullptr};
-        RE::TESFaction* innkeeperHouseMerchantFaction_{nullptr};
-        RE::TESFaction* jewelerHouseMerchantFaction_{nullptr};
-        RE::TESFaction* miscHouseMerchantFaction_{nullptr};
-        RE::TESFaction* spellsHouseMerchantFaction_{nullptr};
-        RE::TESFaction* tailorHouseMerchantFaction_{nullptr};
-
-        // Globals (cached)
-        RE::TESGlobal* loveInterestsCount_{nullptr};
-        RE::TESGlobal* spousesCount_{nullptr};
-        RE::TESGlobal* playerHousesCount_{nullptr};
-        // Keywords (cached)
-        RE::BGSKeyword* ignoreProposeKeyword_{nullptr};
-        RE::BGSKeyword* homeSandboxKeyword_{nullptr};
-        // Static objects (cached)
-        RE::TESObjectSTAT* homeSandboxMarkerStatic_{nullptr};
-        // Packages (cached)
-        RE::TESPackage* homeSandboxPackage_{nullptr};
-        // (No generic cache; use named getters and Utils::LookupForm inside the .cpp)
+        // One slot per getter, resolved by WarmUp
+        enum class Slot : std::uint16_t {
+            TrackedFaction,
+            SpouseSocialClassFaction,
+            SpouseSkillTypeFaction,
+            SpouseTemperamentFaction,
+            SpouseHousedFaction,
+            HierarchyFaction,
+            AffectionFaction,
+            MarriagePotentialFaction,
+            MarriageAskedFaction,
+            CourtingFaction,
+            PotentialHirelingFaction,
+            MarriedFaction,
+            PlayerBedOwnershipFaction,
+            RulerFactions,
+            NobleFactions,
+            ReligiousFactions,
+            WealthyFactions,
+            MiddleFactions,
+            PovertyFactions,
+            OutcastFactions,
+            OratorClasses,
+            RangerClasses,
+            RogueClasses,
+            CraftsmanClasses,
+            MageClasses,
+            WarriorClasses,
+            IgnoreProposeKeyword,
+            PlayerFaction,
+            CompanionsFaction,
+            ThievesFaction,
+            BrotherhoodFaction,
+            CollegeFaction,
+            BardsFaction,
+            MerchantFaction,
+            ApothecaryFaction,
+            BlacksmithFaction,
+            FletcherFaction,
+            InnKeeperFaction,
+            JewelerFaction,
+            MiscFaction,
+            SpellFaction,
+            TailorFaction,
+            HunterFaction,
+            ApothecaryMerchantHousedFaction,
+            BlacksmithMerchantHousedFaction,
+            FletcherMerchantHousedFaction,
+            HunterMerchantHousedFaction,
+            InnkeeperMerchantHousedFaction,
+            JewelerMerchantHousedFaction,
+            MiscMerchantHousedFaction,
+            SpellsMerchantHousedFaction,
+            TailorMerchantHousedFaction,
+            EastmarchThane,
+            FalkreathThane,
+            HaafingarThane,
+            HjaalmarchThane,
+            PaleThane,
+            ReachThane,
+            RiftThane,
+            WhiterunThane,
+            WinterholdThane,
+            CompanionsQuest,
+            CollegeQuest,
+            ThievesQuest,
+            BardsQuest,
+            DragonbornQuest,
+            LoveInterestsCount,
+            SpousesCount,
+            PlayerHousesCount,
+            ClothingRichKeyword,
+            HomeSandboxKeyword,
+            HomeSandboxMarkerStatic,
+            HomeSandboxPackage,
+            _Count
+        };
+        static constexpr std::size_t kSlotCount = static_cast<std::size_t>(Slot::_Count);
+
+        template <typename T>
+        T* Get(Slot slot) const {
+            return static_cast<T*>(forms_[static_cast<std::size_t>(slot)]);
+        }
+
+        // Resolved forms by Slot; nullptr for forms that did not resolve
+        std::array<RE::TESForm*, kSlotCount> forms_{};
+
+        // Immutable membership set for ContainsFast, with the list's stamp and entry counts it was built from
+        struct MembershipSet {
+            std::uint64_t stamp = 0;
+            std::size_t formCount = 0;
+            std::size_t addedCount = 0;
+            std::unordered_set<RE::FormID> forms;
+        };
+        // Per list: the current set, published for lock-free readers, and every set built so far. Superseded sets
+        // stay alive so a reader never sees one freed; they are only built when scripts edit the list.
+        struct ListMembership {
+            std::atomic<const MembershipSet*> current{nullptr};
+            std::mutex rebuildMutex;
+            std::vector<std::unique_ptr<const MembershipSet>> built;
+        };
+        const MembershipSet* RebuildMembership(const RE::BGSListForm* list, ListMembership& membership);
+
+        std::array<ListMembership, static_cast<std::size_t>(ListId::_Count)> listMembership_;
     };
 
 }  // namespace MARAS
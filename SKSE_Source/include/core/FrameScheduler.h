@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace MARAS {
+
+    // Runs named periodic jobs from a per-frame hook (PlayerCharacter::Update, so nothing runs while the game is
+    // paused). Due times live on a hashed timer wheel: each frame only the slots that elapsed since the previous
+    // frame are visited. Due jobs are run in order until the per-frame budget is spent; the rest carry over to the
+    // next frame ahead of anything newly due, so every job keeps its cadence and a frame never runs more than one
+    // job past the budget.
+    //
+    // Main thread only.
+    class FrameScheduler {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using Job = std::function<void()>;
+
+        static FrameScheduler& GetSingleton();
+
+        // Install the per-frame update hook. Must be called during SKSE hook installation.
+        static void InstallHooks();
+
+        // Register (or replace) a periodic job. The first run happens after interval plus up to `jitter`;
+        // later runs are interval +/- jitter apart, which keeps jobs with equal intervals from piling onto one frame.
+        void Schedule(std::string name, std::chrono::milliseconds interval, Job job,
+                      std::chrono::milliseconds jitter = std::chrono::milliseconds{0});
+
+        // Remove a job by name. Returns false if no such job is scheduled.
+        bool Cancel(std::string_view name);
+
+        void SetFrameBudget(std::chrono::microseconds budget) { frameBudget_ = budget; }
+
+        // Advance the wheel and run due jobs. Called once per frame by the hook.
+        void Tick();
+
+    private:
+        FrameScheduler();
+
+        struct Entry {
+            std::string name;
+            std::chrono::milliseconds interval{0};
+            std::chrono::milliseconds jitter{0};
+            Job job;
+            std::uint64_t dueTick = 0;
+            bool active = false;
+        };
+
+        struct PlayerUpdateHook;  // defined in FrameScheduler.cpp
+
+        // Wheel geometry: 256 slots of 50 ms cover 12.8 s; longer intervals wait in their slot for extra laps
+        static constexpr std::size_t kWheelSize = 256;
+        static constexpr std::chrono::milliseconds kTickResolution{50};
+        static constexpr std::chrono::microseconds kDefaultFrameBudget{500};
+
+        struct NameHash {
+            using is_transparent = void;
+            std::size_t operator()(std::string_view name) const noexcept { return std::hash<std::string_view>{}(name); }
+        };
+
+        std::uint64_t CurrentTick(Clock::time_point now) const;
+        void Arm(std::uint32_t index, std::uint64_t fromTick, bool firstRun);
+        // Return a cancelled entry to the free list. Only called once nothing references the index: it was dropped
+        // from the wheel or the ready queue, or finished running.
+        void Reclaim(std::uint32_t index);
+
+        std::deque<Entry> jobs_;  // deque keeps references stable while a running job schedules another
+        std::vector<std::uint32_t> freeJobs_;  // reclaimed jobs_ indices, reused by Schedule
+        std::unordered_map<std::string, std::uint32_t, NameHash, std::equal_to<>> jobsByName_;  // active jobs only
+        std::array<std::vector<std::uint32_t>, kWheelSize> wheel_;
+        std::deque<std::uint32_t> ready_;  // due but not yet run (budget carry-over)
+
+        Clock::time_point origin_;
+        std::uint64_t lastTick_ = 0;
+        std::chrono::microseconds frameBudget_ = kDefaultFrameBudget;
+        std::minstd_rand rng_;
+    };
+
+}  // namespace MARAS
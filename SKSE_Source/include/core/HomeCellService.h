@@ -1,7 +1,10 @@
 #pragma once
 
-#include <map>
+#include <cstdint>
+#include <filesystem>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "utils/Common.h"
@@ -12,29 +15,53 @@ namespace MARAS {
         std::vector<RE::FormID> doors;  // door reference FormIDs inside the cell
         RE::FormID centerMarker = 0;    // LocationCenterMarker reference FormID
     };
+    // ownedFurniture storage removed; we'll compute owned furniture on demand.
+
+    // Read-only FormID -> [FormID] multimap in CSR layout: sorted unique keys, and per key an offset range into
+    // one shared value pool. Built once from (key, value) pairs; values keep their input order per key.
+    class FlatFormIDMultimap {
+    public:
+        void Build(std::vector<std::pair<RE::FormID, RE::FormID>>& pairs);
+        void Clear();
 
-    struct ActorHomeData {
-        RE::FormID homeCell = 0;  // cell formID where actor has a persistent ref
+        std::span<const RE::FormID> Find(RE::FormID key) const;
+
+        std::span<const RE::FormID> Keys() const { return keys_; }
+        std::span<const RE::FormID> ValuesAt(std::size_t keyIndex) const;
+        std::size_t KeyCount() const { return keys_.size(); }
+        std::size_t ValueCount() const { return values_.size(); }
+        std::size_t MemoryBytes() const;
+
+    private:
+        std::vector<RE::FormID> keys_;
+        std::vector<std::uint32_t> offsets_;  // keys_.size() + 1 entries
+        std::vector<RE::FormID> values_;
     };
-    // ownedFurniture storage removed; we'll compute owned furniture on demand.
 
-    // Service that scans interior cells after data load and builds lookup maps:
-    // - homeCells: cellID -> HomeCellData
-    // - actorsWithHome: actorID -> ActorHomeData
-    // - bedsWithOwners: ownerID -> [bedRefID]
+    // Service that scans interior cells after data load and builds lookup tables:
+    // - home cells: cellID -> doors + center marker
+    // - actors with home: actorID -> cellID
+    // - beds with owners: ownerID -> [bedRefID]
+    // - reverse lists: cellID -> [actorID], cellID -> [owned bedRefID]
+    // The index is written once per game launch and then only read, so everything is stored in sorted flat
+    // arrays (binary searched) instead of node-based maps.
     class HomeCellService {
     public:
         static HomeCellService& GetSingleton();
 
         HomeCellService();
 
-        // Build/refresh the index (call once after SKSE data is loaded)
+        // Build/refresh the index (call once after SKSE data is loaded). Loads the on-disk cache when it
+        // matches the current load order, otherwise scans the interior cells and rewrites the cache.
         void BuildIndex();
 
-        // Queries
+        // Queries. Returned spans point into the index and stay valid until the next BuildIndex/Revert.
         RE::FormID GetNpcHome(RE::Actor* npc) const;
-        std::vector<RE::FormID> GetNpcBeds(RE::Actor* npc) const;
-        std::vector<RE::FormID> GetCellDoors(RE::FormID cellFormID) const;
+        std::span<const RE::FormID> GetNpcBeds(RE::Actor* npc) const;
+        std::span<const RE::FormID> GetCellDoors(RE::FormID cellFormID) const;
+        // Actors whose recorded home is the cell, and owned bed references inside the cell
+        std::span<const RE::FormID> GetCellActors(RE::FormID cellFormID) const;
+        std::span<const RE::FormID> GetCellBeds(RE::FormID cellFormID) const;
         RE::FormID GetNpcOriginalHouseCenterMarker(RE::Actor* npc) const;
 
         // Log stored index contents (cell name, location, doors, actors, beds)
@@ -43,22 +70,64 @@ namespace MARAS {
         void Revert();
 
     private:
-        // Scans a single cell, fills outData with doors and records furniture/actors.
-        // Returns true if the cell contains at least one persistent actor reference.
-        bool ScanCell(RE::TESObjectCELL* cell, HomeCellData& outData);
-
-        // Helper methods for ScanCell
-        void ProcessBedOwnership(RE::TESObjectREFR& bedRef);
-        void ProcessActorHome(RE::FormID actorFormId, RE::FormID cellId);
+        // Output of scanning a contiguous chunk of candidate cells. Chunks are scanned on worker
+        // threads and merged in cell order, so the result matches a single-threaded scan.
+        struct ScanResult {
+            std::vector<std::pair<RE::FormID, HomeCellData>> cells;     // cells with persistent actors
+            std::vector<std::pair<RE::FormID, RE::FormID>> actorHomes;  // actor -> cell, in scan order
+            std::vector<std::pair<RE::FormID, RE::FormID>> ownedBeds;   // owner -> bed, in scan order
+            std::vector<std::pair<RE::FormID, RE::FormID>> cellBeds;    // cell -> owned bed, in scan order
+        };
+
+        // Forms needed by the scan, resolved once per BuildIndex
+        struct ScanContext {
+            RE::BGSKeyword* kwDwelling = nullptr;
+            RE::BGSKeyword* kwHouse = nullptr;
+            RE::BGSLocationRefType* centerMarkerType = nullptr;
+        };
+
+        // Scans a single cell, fills outData with doors and records owned beds/persistent actors into out.
+        // Returns true if the cell contains at least one persistent actor reference. Thread-safe: touches no
+        // service state.
+        static bool ScanCell(RE::TESObjectCELL* cell, const ScanContext& ctx, HomeCellData& outData,
+                             ScanResult& out);
+
+        // Sort and pack the merged scan output into the flat tables (first home seen for an actor wins)
+        void Freeze(ScanResult& result);
+        void Clear();
+
+        // Full scan of dataHandler->interiorCells into the (already cleared) index
+        void ScanInteriorCells();
+
+        // Index cache: a flat binary dump of the lookup tables, valid only for the load order it was built from.
+        // The hash covers each active plugin's name, load index, size and modification time.
+        static std::uint64_t ComputeLoadOrderHash();
+        bool LoadIndexCache(const std::filesystem::path& path, std::uint64_t loadOrderHash);
+        bool SaveIndexCache(const std::filesystem::path& path, std::uint64_t loadOrderHash) const;
+
+        // Position of cellId in cellIds_, or cellIds_.size() if absent
+        std::size_t FindCell(RE::FormID cellId) const;
+        std::size_t MemoryBytes() const;
 
         // Helper methods for LogIndex
         std::string GetLocationInfo(const RE::TESObjectCELL* cell) const;
         std::string GetActorsInCell(RE::FormID cellId) const;
         std::string GetBedsInCell(RE::FormID cellId) const;
 
-        std::map<RE::FormID, HomeCellData> homeCells_;                  // cellFormID -> data
-        std::map<RE::FormID, ActorHomeData> actorsWithHome_;            // actorFormID -> data
-        std::map<RE::FormID, std::vector<RE::FormID>> bedsWithOwners_;  // ownerActorFormID -> [bedRefFormID]
+        // Home cells: parallel arrays sorted by cell FormID; doors are the values of cellDoors_
+        std::vector<RE::FormID> cellIds_;
+        std::vector<RE::FormID> cellCenterMarkers_;
+        FlatFormIDMultimap cellDoors_;  // cellFormID -> [doorRefFormID]
+
+        // Actors with home: parallel arrays sorted by actor FormID
+        std::vector<RE::FormID> actorIds_;
+        std::vector<RE::FormID> actorHomeCells_;
+
+        FlatFormIDMultimap bedsWithOwners_;  // ownerActorFormID -> [bedRefFormID]
+
+        // Reverse adjacency lists, built alongside the forward tables
+        FlatFormIDMultimap cellActors_;  // cellFormID -> [actorFormID]
+        FlatFormIDMultimap cellBeds_;    // cellFormID -> [owned bedRefFormID]
     };
 
 }  // namespace MARAS
@@ -1,12 +1,73 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
 #include <nlohmann/json.hpp>
-#include <unordered_map>
 
 #include "utils/Common.h"
 
 namespace MARAS {
 
+    // Marriage difficulty configuration compiled from marriageDifficultyConfig.json. Keys missing from the file
+    // are resolved to 0 when the config is loaded, so the calculator reads plain fields.
+    struct alignas(64) DifficultyParams {
+        // difficultyCalculation
+        float sigmoidSteepness = 0.0f;
+        float sigmoidCenter = 0.0f;
+        float difficultyClampMin = 0.0f;
+        float difficultyClampMax = 0.0f;
+
+        // complexity
+        float initialComplexity = 0.0f;
+        float levelDiffClampMin = 0.0f;
+        float levelDiffClampMax = 0.0f;
+
+        // prestige
+        float prestigeDragonbornBonus = 0.0f;
+        float prestigeThaneHoldValue = 0.0f;
+        float prestigeMaxThaneHolds = 0.0f;
+        float prestigeGuildLeaderBonus = 0.0f;
+        float prestigeMostGoldDivisor = 0.0f;
+        float prestigeMostGoldClampMax = 0.0f;
+        float prestigeHouseUnitMultiplier = 0.0f;
+        float prestigeHorseUnitMultiplier = 0.0f;
+        float prestigeHouseHorseClampMax = 0.0f;
+        float prestigeQuestsMultiplier = 0.0f;
+        float prestigeDungeonsMultiplier = 0.0f;
+        float prestigeSoulsMultiplier = 0.0f;
+        float prestigeRenownClampMax = 0.0f;
+        float prestigeClampMin = 0.0f;
+        float prestigeClampMax = 0.0f;
+        float prestigeTargetBase = 0.0f;
+        float prestigeTargetPerSocialIndexMultiplier = 0.0f;
+        float prestigeDeltaMultiplier = 0.0f;
+
+        // penalties
+        float jiltedPenalty = 0.0f;
+        float divorcedPenalty = 0.0f;
+        float playerKillerPenalty = 0.0f;
+
+        // multipliers
+        float marriedCountMultiplier = 0.0f;
+        float divorcedCountMultiplier = 0.0f;
+        float levelDiffMultiplier = 0.0f;
+        float speechcraftMultiplier = 0.0f;
+        float relationshipRankMultiplier = 0.0f;
+        float affectionMultiplier = 0.0f;
+
+        // guilds: modifier by guild and spouse social class
+        enum Guild : std::size_t { kCompanions, kThieves, kBrotherhood, kCollege, kBards, kGuildCount };
+        static constexpr std::size_t kSocialClassCount = 8;
+        float sameGuildBonus = 0.0f;
+        std::array<std::array<float, kSocialClassCount>, kGuildCount> guildModifiers{};
+    };
+
     class MarriageDifficulty {
     public:
         // Calculate marriage success chance on-the-fly
@@ -15,27 +76,81 @@ namespace MARAS {
                                                     float dungeonsCleared, float dragonSoulsCollected,
                                                     bool playerKiller);
 
-        // Load configuration from JSON file
+        // Batch variant for ranking many candidates. Player-side terms (prestige, speechcraft, spouse and divorce
+        // counts, guild membership) are computed once; each NPC then only adds its own terms. chances[i] belongs to
+        // npcs[i] and is 0 for a null actor. Missing intimacy adjustments count as 0.
+        static std::vector<float> CalculateMarriageSuccessChances(std::span<RE::Actor* const> npcs,
+                                                                  std::span<const float> intimacyAdjustments,
+                                                                  float mostGold, float housesOwned, float horsesOwned,
+                                                                  float questsCompleted, float dungeonsCleared,
+                                                                  float dragonSoulsCollected, bool playerKiller);
+
+        // Load configuration from JSON file. The compiled parameters replace the current ones atomically, so a
+        // reload never exposes a half-filled block.
         static bool LoadConfig();
 
+        // Quest-derived player standing is cached between chance queries. Quest stage events for one of the
+        // standing quests drop the cache; a game load or revert drops it unconditionally.
+        static void OnQuestStageChanged(RE::FormID questFormID);
+        static void InvalidatePlayerStanding();
+
     private:
+        // Player standing that only changes when a quest advances: the quest-based prestige terms and the Bards
+        // College membership
+        struct PlayerStandingSnapshot {
+            bool dragonborn = false;
+            int thaneHolds = 0;
+            bool guildLeader = false;
+            bool bardsMember = false;
+        };
+
+        // Player-dependent part of the calculation, shared by every NPC evaluated against the same player state
+        struct PlayerTerms {
+            RE::TESNPC* playerBase = nullptr;
+            int level = 0;
+            float prestige = 0.0f;
+            bool playerKiller = false;
+            float marriedScore = 0.0f;
+            float divorcedScore = 0.0f;
+            float speechScore = 0.0f;
+            std::array<RE::TESFaction*, DifficultyParams::kGuildCount> guildFactions{};
+            std::array<bool, DifficultyParams::kGuildCount> inGuild{};
+        };
+
+        static bool CapturePlayerTerms(const DifficultyParams& params, float mostGold, float housesOwned,
+                                       float horsesOwned, float questsCompleted, float dungeonsCleared,
+                                       float dragonSoulsCollected, bool playerKiller, PlayerTerms& out);
+        // Chance for one NPC; difficulty receives the clamped difficulty for logging
+        static float EvaluateChance(const DifficultyParams& params, const PlayerTerms& terms, RE::Actor* npc,
+                                    float intimacyAdjustment, float& difficulty);
+
         // Helper methods for individual calculations
         static bool CheckQuestStage(RE::TESQuest* quest, std::uint32_t stage);
-        static float GetParam(const std::string& param);
+        static std::shared_ptr<const DifficultyParams> GetParams();
         static int GetThaneHolds();
         static bool IsGuildLeader();
-        static float CalculatePlayerPrestige(float mostGold, float housesOwned, float horsesOwned,
+        // Cached snapshot, rebuilt from the quests on the first query after an invalidation
+        static PlayerStandingSnapshot GetPlayerStanding();
+        static float CalculatePlayerPrestige(const DifficultyParams& params, const PlayerStandingSnapshot& standing,
+                                             float mostGold, float housesOwned, float horsesOwned,
                                              float questsCompleted, float dungeonsCleared, float dragonSoulsCollected);
-        static float CalculateGuildAlignmentMod(RE::Actor* npc);
+        static float CalculateGuildAlignmentMod(const DifficultyParams& params, const PlayerTerms& terms,
+                                                RE::Actor* npc);
         static bool IsAlwaysSuccessMarriage();
         static bool IsJilted(RE::Actor* npc);
         static bool IsDivorced(RE::Actor* npc);
         static int CountMarried();
         static int CountDivorced();
 
-        // Configuration storage
-        static std::unordered_map<std::string, float> config_;
-        static bool configLoaded_;
+        // Configuration storage (all zero until the first LoadConfig)
+        static std::atomic<std::shared_ptr<const DifficultyParams>> params_;
+
+        // Player standing cache. Chance queries come from Papyrus threads and stage events from the main thread.
+        static std::mutex standingMutex_;
+        static std::optional<PlayerStandingSnapshot> standing_;
+        static std::vector<RE::FormID> standingQuests_;  // quests the snapshot was built from
+        static std::atomic<std::uint64_t> standingHits_;
+        static std::atomic<std::uint64_t> standingMisses_;
     };
 
 }  // namespace MARAS
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+
+// NPC attribute enums, kept free of game headers so code that only computes attributes can be built and tested
+// on its own
+namespace MARAS {
+
+    // Enums for NPC attributes
+    enum class SocialClass : uint8_t {
+        Outcast = 0,
+        Poverty = 1,
+        Working = 2,
+        Middle = 3,
+        Wealthy = 4,
+        Religious = 5,
+        Nobles = 6,
+        Rulers = 7,
+        // Sentinel for range checking (not a valid value)
+        _Count
+    };
+
+    enum class SkillType : uint8_t {
+        Warrior = 0,
+        Mage = 1,
+        Rogue = 2,
+        Craftsman = 3,
+        Ranger = 4,
+        Orator = 5,
+        // Sentinel for range checking (not a valid value)
+        _Count
+    };
+
+    enum class Temperament : uint8_t {
+        Proud = 0,
+        Humble = 1,
+        Jealous = 2,
+        Romantic = 3,
+        Independent = 4,
+        // Sentinel for range checking (not a valid value)
+        _Count
+    };
+
+    enum class RelationshipStatus : uint8_t {
+        Candidate = 0,
+        Engaged = 1,
+        Married = 2,
+        Divorced = 3,
+        Jilted = 4,
+        // Note: Deceased (5) was removed - NPCs are now unregistered on death
+        // Don't use 5 as it may be used in external Papyrus scripts for backward compatibility
+        // Unknown is used as a default/absent value when no stored data exists
+        Unknown = 255
+    };
+
+    // Compile-time validation: ensure enums fit in uint8_t for serialization
+    static_assert(static_cast<uint8_t>(SocialClass::_Count) <= 255,
+                  "SocialClass enum exceeds uint8_t range");
+    static_assert(static_cast<uint8_t>(SkillType::_Count) <= 255,
+                  "SkillType enum exceeds uint8_t range");
+    static_assert(static_cast<uint8_t>(Temperament::_Count) <= 255,
+                  "Temperament enum exceeds uint8_t range");
+    static_assert(static_cast<uint8_t>(RelationshipStatus::Jilted) < 255,
+                  "RelationshipStatus valid values must be less than Unknown sentinel");
+
+}  // namespace MARAS
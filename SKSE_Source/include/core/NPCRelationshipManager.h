@@ -1,12 +1,17 @@
 #pragma once
 
+#include <array>
 #include <functional>
+#include <limits>
 #include <optional>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "RE/Skyrim.h"
+#include "core/NPCAttributes.h"
 #include "core/Serialization.h"
 #include "utils/Common.h"
 #include "utils/JsonOverrideLoader.h"
@@ -18,62 +23,7 @@ namespace SKSE {
 
 namespace MARAS {
 
-    // Enums for NPC attributes
-    enum class SocialClass : uint8_t {
-        Outcast = 0,
-        Poverty = 1,
-        Working = 2,
-        Middle = 3,
-        Wealthy = 4,
-        Religious = 5,
-        Nobles = 6,
-        Rulers = 7,
-        // Sentinel for range checking (not a valid value)
-        _Count
-    };
-
-    enum class SkillType : uint8_t {
-        Warrior = 0,
-        Mage = 1,
-        Rogue = 2,
-        Craftsman = 3,
-        Ranger = 4,
-        Orator = 5,
-        // Sentinel for range checking (not a valid value)
-        _Count
-    };
-
-    enum class Temperament : uint8_t {
-        Proud = 0,
-        Humble = 1,
-        Jealous = 2,
-        Romantic = 3,
-        Independent = 4,
-        // Sentinel for range checking (not a valid value)
-        _Count
-    };
-
-    enum class RelationshipStatus : uint8_t {
-        Candidate = 0,
-        Engaged = 1,
-        Married = 2,
-        Divorced = 3,
-        Jilted = 4,
-        // Note: Deceased (5) was removed - NPCs are now unregistered on death
-        // Don't use 5 as it may be used in external Papyrus scripts for backward compatibility
-        // Unknown is used as a default/absent value when no stored data exists
-        Unknown = 255
-    };
-
-    // Compile-time validation: ensure enums fit in uint8_t for serialization
-    static_assert(static_cast<uint8_t>(SocialClass::_Count) <= 255,
-                  "SocialClass enum exceeds uint8_t range");
-    static_assert(static_cast<uint8_t>(SkillType::_Count) <= 255,
-                  "SkillType enum exceeds uint8_t range");
-    static_assert(static_cast<uint8_t>(Temperament::_Count) <= 255,
-                  "Temperament enum exceeds uint8_t range");
-    static_assert(static_cast<uint8_t>(RelationshipStatus::Jilted) < 255,
-                  "RelationshipStatus valid values must be less than Unknown sentinel");
+    struct ActorSnapshot;
 
     // Lightweight data structure for NPC information
     struct NPCRelationshipData {
@@ -116,30 +66,92 @@ namespace MARAS {
               marriageDate(0) {}
     };
 
-    // Main storage and management class
-    class NPCRelationshipManager {
+    // Flat, status-indexed roster of registered NPCs.
+    //
+    // Records are stored inline in a slot array; a slot stays put for as long as the NPC is registered
+    // and freed slots are recycled. A FormID-sorted (FormID, slot) table gives O(log n) lookup, and
+    // each relationship status owns a dense FormID array so bulk queries never walk the records.
+    // Every record remembers its position in the dense arrays, so moving an NPC between statuses is a
+    // swap-remove plus a push_back and allocates nothing once capacity is warm.
+    class NPCRoster {
+    public:
+        static constexpr std::size_t kStatusCount = static_cast<std::size_t>(RelationshipStatus::Jilted) + 1;
+        static constexpr std::uint32_t kInvalidPos = std::numeric_limits<std::uint32_t>::max();
+
+        // Lookup (nullptr if the NPC is not registered)
+        NPCRelationshipData* Find(RE::FormID npcFormID);
+        const NPCRelationshipData* Find(RE::FormID npcFormID) const;
+        bool Contains(RE::FormID npcFormID) const { return FindSlot(npcFormID) != kInvalidPos; }
+
+        // Slot access. A slot is stable while its NPC stays registered and is reused after Erase, so services
+        // keeping per-NPC data in parallel arrays must check that the slot still belongs to the same FormID.
+        std::uint32_t SlotOf(RE::FormID npcFormID) const { return FindSlot(npcFormID); }
+        std::size_t SlotCount() const { return records_.size(); }
+        const NPCRelationshipData* AtSlot(std::uint32_t slot) const {
+            return (slot < records_.size() && records_[slot].formID != 0) ? &records_[slot] : nullptr;
+        }
+
+        // Insert a new record; returns nullptr if the FormID is already present
+        NPCRelationshipData* Insert(NPCRelationshipData data);
+        bool Erase(RE::FormID npcFormID);
+
+        // Move a registered NPC to another status bucket (also updates record.status)
+        bool SetStatus(RE::FormID npcFormID, RelationshipStatus status);
+
+        void Clear();
+        void Reserve(std::size_t count);
+
+        // Dense views, valid until the next mutating call
+        std::size_t Size() const { return all_.size(); }
+        std::size_t CountByStatus(RelationshipStatus status) const;
+        const std::vector<RE::FormID>& All() const { return all_; }
+        const std::vector<RE::FormID>& ByStatus(RelationshipStatus status) const;
+
+        // Visit every live record (slot order)
+        template <typename Fn>
+        void ForEachRecord(Fn&& fn) const {
+            for (const auto& record : records_) {
+                if (record.formID != 0) {
+                    fn(record);
+                }
+            }
+        }
+
     private:
-        // Master set - all registered NPCs
-        std::unordered_set<RE::FormID> allRegistered;
+        struct SlotLinks {
+            std::uint32_t allPos = kInvalidPos;
+            std::uint32_t statusPos = kInvalidPos;
+        };
 
-        // Status buckets for fast filtering
-        std::unordered_set<RE::FormID> candidates;
-        std::unordered_set<RE::FormID> engaged;
-        std::unordered_set<RE::FormID> married;
-        std::unordered_set<RE::FormID> divorced;
-        std::unordered_set<RE::FormID> jilted;
+        static bool IsBucketStatus(RelationshipStatus status) {
+            return static_cast<std::size_t>(status) < kStatusCount;
+        }
 
-        // Detailed data storage
-        std::unordered_map<RE::FormID, NPCRelationshipData> npcData;
+        std::uint32_t FindSlot(RE::FormID npcFormID) const;
+        void LinkStatus(std::uint32_t slot, RelationshipStatus status);
+        void UnlinkStatus(std::uint32_t slot);
+
+        // Swap-remove `pos` from a dense array and patch the moved element's back-link
+        void SwapRemove(std::vector<RE::FormID>& dense, std::uint32_t pos, std::uint32_t SlotLinks::*link);
+
+        std::vector<NPCRelationshipData> records_;
+        std::vector<SlotLinks> links_;
+        std::vector<std::uint32_t> freeSlots_;
+        std::vector<std::pair<RE::FormID, std::uint32_t>> index_;  // sorted by FormID
+
+        std::vector<RE::FormID> all_;
+        std::array<std::vector<RE::FormID>, kStatusCount> byStatus_;
+    };
+
+    // Main storage and management class
+    class NPCRelationshipManager {
+    private:
+        // All registered NPCs, their data and per-status buckets
+        NPCRoster roster;
 
         // Override data storage
         Utils::OverrideMap npcOverrides;
 
-        // Private helper methods
-        void RemoveFromAllBuckets(RE::FormID npcFormID);
-        void AddToBucket(RE::FormID npcFormID, RelationshipStatus status);
-        void RemoveFromBucket(RE::FormID npcFormID, RelationshipStatus status);
-
         // Centralized status-change helper to reduce duplication in Promote*/Demote methods
         bool ChangeStatusCommon(RE::FormID npcFormID, RelationshipStatus status,
                                 const std::function<void(RE::FormID)>& postAction = nullptr);
@@ -147,6 +159,31 @@ namespace MARAS {
         // Faction management helper
         void UpdateTrackedFactionRank(RE::FormID npcFormID, RelationshipStatus status);
 
+        // Tracked faction rank, status factions and maras_status_changed event for one NPC. Runs
+        // immediately, or is queued for CommitBatch() while a batch is open.
+        void ApplyStatusSideEffects(RE::FormID npcFormID, RelationshipStatus status);
+
+        // Mark the globals dirty and flush them unless a batch is open
+        void RequestGlobalsUpdate();
+
+        // Batch state (see BeginBatch/CommitBatch): every status transition in order, and the last
+        // status queued per NPC so an immediate repeat of the same status is queued once
+        std::uint32_t batchDepth = 0;
+        std::vector<std::pair<RE::FormID, RelationshipStatus>> batchTransitions;
+        std::unordered_map<RE::FormID, RelationshipStatus> batchLastStatus;
+
+        // Running love interest (engaged + married) and spouse counters, kept in step with the
+        // roster through per-transition deltas
+        std::int32_t loveInterestCount = 0;
+        std::int32_t spouseCount = 0;
+        bool globalsDirty = false;
+
+        void TrackStatusDelta(RelationshipStatus from, RelationshipStatus to);
+        void RecountCounters();
+
+        // Debug-build check that the running counters match the roster buckets
+        bool AuditCounters() const;
+
         // Event sending helper
         void SendStatusChangedEvent(RE::FormID npcFormID, RelationshipStatus status);
 
@@ -156,8 +193,6 @@ namespace MARAS {
         // Ensure NPC is registered prior to mutating operations
         bool EnsureRegistered(RE::FormID npcFormID);
 
-        // Recalculate and update game globals for love interests and spouse counts
-        void RecalculateAndUpdateGlobals();
 
         // Helper to look up override data by reference ID or base actor ID
         const Utils::NPCOverrideData* FindOverrideData(RE::FormID npcFormID) const;
@@ -165,6 +200,21 @@ namespace MARAS {
         // Helper to set linked reference for home marker
         void SetLinkedRefForHomeMarker(RE::FormID npcFormID, RE::FormID markerFormID);
 
+        // Attributes of a new candidate, determined before anything is stored
+        struct CandidateAttributes {
+            SocialClass socialClass = SocialClass::Working;
+            SkillType skillType = SkillType::Warrior;
+            Temperament temperament = Temperament::Proud;
+        };
+
+        // Determine a candidate's attributes (overrides first) from a snapshot taken with
+        // NPCTypeDeterminer::SnapshotActor. Reads no live game state, only the snapshot, the override map and
+        // NPCTypeDeterminer's locked caches, so several NPCs can be classified in parallel.
+        CandidateAttributes ClassifyCandidate(const ActorSnapshot& snapshot) const;
+
+        // Store a classified candidate and add it to its attribute factions; false if the roster insert failed
+        bool StoreCandidate(RE::FormID npcFormID, const CandidateAttributes& attributes);
+
     public:
         // Singleton access
         static NPCRelationshipManager& GetSingleton();
@@ -173,6 +223,15 @@ namespace MARAS {
         bool RegisterAsCandidate(RE::FormID npcFormID);  // New method with auto-determination
         bool UnregisterNPC(RE::FormID npcFormID);
 
+        // Bulk registration. Attributes of all new candidates are classified on a worker pool first; the roster
+        // inserts, faction writes, globals and status events then happen in one batch on the calling thread.
+        // results[i] belongs to actors[i]: Skipped for the player, duplicates and NPCs already registered.
+        enum class BulkRegisterResult : std::int8_t { Failed = -1, Skipped = 0, Registered = 1 };
+        std::vector<BulkRegisterResult> RegisterCandidates(std::span<RE::Actor* const> actors);
+
+        // Living adult NPCs with loaded 3D in the high process list that are not registered yet
+        std::vector<RE::Actor*> CollectLoadedCandidates() const;
+
         // Faction management methods
         bool AddToSocialClassFaction(RE::FormID npcFormID, std::int8_t rank);
         bool AddToSkillTypeFaction(RE::FormID npcFormID, std::int8_t rank);
@@ -195,6 +254,16 @@ namespace MARAS {
         bool PromoteToDivorced(RE::FormID npcFormID);  // From married
         bool PromoteToJilted(RE::FormID npcFormID);    // From engaged
 
+        // Batched status transitions. While a batch is open, registrations and status changes update
+        // the roster immediately, but tracked-faction ranks, status factions, the TT_MARAS globals and
+        // maras_status_changed events are deferred to the outermost CommitBatch(). The commit replays
+        // the faction pass and event for every transition in order (e.g. candidate, then married), so
+        // listeners see the same sequence as unbatched calls; only a repeat of the same status is
+        // dropped. Batches nest.
+        void BeginBatch();
+        void CommitBatch();
+        bool IsBatching() const { return batchDepth > 0; }
+
         // Bulk retrievals
         std::vector<RE::FormID> GetAllRegisteredNPCs() const;
         std::vector<RE::FormID> GetAllCandidates() const;
@@ -203,6 +272,23 @@ namespace MARAS {
         std::vector<RE::FormID> GetAllDivorced() const;
         std::vector<RE::FormID> GetAllJilted() const;
 
+        // Zero-copy bulk views over the roster's dense arrays. Views are invalidated by any
+        // registration, unregistration or status change, so don't hold them across such calls.
+        std::span<const RE::FormID> ViewAllRegistered() const { return roster.All(); }
+        std::span<const RE::FormID> ViewByStatus(RelationshipStatus status) const { return roster.ByStatus(status); }
+
+        template <typename Fn>
+        void ForEachByStatus(RelationshipStatus status, Fn&& fn) const {
+            for (auto npcFormID : roster.ByStatus(status)) {
+                fn(npcFormID);
+            }
+        }
+
+        // Roster slot of a registered NPC (NPCRoster::kInvalidPos if not registered), for per-NPC parallel arrays
+        std::uint32_t GetRosterSlot(RE::FormID npcFormID) const { return roster.SlotOf(npcFormID); }
+        std::size_t GetRosterSlotCount() const { return roster.SlotCount(); }
+        const NPCRelationshipData* GetNPCDataBySlot(std::uint32_t slot) const { return roster.AtSlot(slot); }
+
         // Data access
         const NPCRelationshipData* GetNPCData(RE::FormID npcFormID) const;
         RelationshipStatus GetRelationshipStatus(RE::FormID npcFormID) const;
@@ -248,6 +334,11 @@ namespace MARAS {
         size_t GetMarriedCount() const;
         size_t GetDivorcedCount() const;
         size_t GetJiltedCount() const;
+        size_t GetCountByStatus(RelationshipStatus status) const { return roster.CountByStatus(status); }
+
+        // Write the love interest/spouse counters to the TT_MARAS globals if they are dirty. Only
+        // globals whose value actually differs are touched. Safe to call every update tick.
+        void FlushGlobals();
 
         // Save/Load support
         void Clear();
@@ -262,4 +353,16 @@ namespace MARAS {
         void LogNPCDetails(RE::FormID npcFormID) const;
     };
 
+    // RAII scope for NPCRelationshipManager::BeginBatch/CommitBatch
+    class StatusTransitionBatch {
+    public:
+        StatusTransitionBatch() { NPCRelationshipManager::GetSingleton().BeginBatch(); }
+        ~StatusTransitionBatch() { NPCRelationshipManager::GetSingleton().CommitBatch(); }
+
+        StatusTransitionBatch(const StatusTransitionBatch&) = delete;
+        StatusTransitionBatch(StatusTransitionBatch&&) = delete;
+        StatusTransitionBatch& operator=(const StatusTransitionBatch&) = delete;
+        StatusTransitionBatch& operator=(StatusTransitionBatch&&) = delete;
+    };
+
 }  // namespace MARAS
@@ -1,18 +1,54 @@
 ﻿#pragma once
 
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <functional>
+#include <mutex>
 #include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "RE/Skyrim.h"
 #include "core/NPCRelationshipManager.h"  // for enum types
+#include "core/SkillRules.h"
 
 namespace MARAS {
 
-    // A stateless helper that encapsulates NPC attribute determination logic.
+    struct ActorSnapshot;
+
+    // A helper that encapsulates NPC attribute determination logic.
     // It performs read-only queries against game forms and FormCache and returns
-    // computed enum values. All persistence remains in NPCRelationshipManager.
+    // computed enum values. All persistence remains in NPCRelationshipManager; the
+    // determiner only keeps the temperament matrix, skill rules and lookup caches.
     class NPCTypeDeterminer {
     public:
+        // Where a determined attribute came from
+        enum class AttributeSource : std::uint8_t { Faction, Class, Skills, Default };
+
+        static constexpr std::size_t kSocialClassCount = static_cast<std::size_t>(SocialClass::_Count);
+        static constexpr std::size_t kSkillTypeCount = static_cast<std::size_t>(SkillType::_Count);
+
+        // Temperament by [social class][skill type]
+        using TemperamentMatrix = std::array<std::array<Temperament, kSkillTypeCount>, kSocialClassCount>;
+
+        // Skills read for skill-based detection (the 18 skill actor values) and how each one counts; see
+        // SkillRules.h
+        static constexpr std::size_t kSkillCount = SkillRules::kSkillCount;
+        using SkillRule = SkillRules::SkillRule;
+        using SkillRuleTable = SkillRules::SkillRuleTable;
+
+        // Detection results that depend only on the actor base: its highest faction social class and its skill
+        // type. Overrides (which may target a single reference) and worn clothing stay per actor.
+        struct BaseAttributes {
+            bool hasFactions = false;
+            int factionClass = -1;  // highest SocialClass among the base's factions, -1 if none is listed
+            AttributeSource socialSource = AttributeSource::Default;
+            SkillType skillType = SkillType::Warrior;
+            AttributeSource skillSource = AttributeSource::Default;
+        };
+
         // Determine SocialClass for an NPC. If an override provider returns a string,
         // that value is used; otherwise faction-based detection is used.
         static SocialClass DetermineSocialClass(
@@ -23,6 +59,18 @@ namespace MARAS {
         static SkillType DetermineSkillType(
             RE::FormID npcFormID, const std::function<std::optional<std::string>(RE::FormID)>& getSkillTypeOverride);
 
+        // Copy what detection reads from a live actor. Call on the thread that owns the game state; the snapshot
+        // can then be classified on any thread with the overloads below.
+        static ActorSnapshot SnapshotActor(RE::Actor* actor);
+
+        // Same as the FormID overloads, but read only the snapshot (and the determiner's own indexes)
+        static SocialClass DetermineSocialClass(
+            const ActorSnapshot& snapshot,
+            const std::function<std::optional<std::string>(RE::FormID)>& getSocialClassOverride);
+        static SkillType DetermineSkillType(
+            const ActorSnapshot& snapshot,
+            const std::function<std::optional<std::string>(RE::FormID)>& getSkillTypeOverride);
+
         // Determine Temperament for an NPC. If an override provider returns a string,
         // that value is used; otherwise the temperament matrix is applied using the
         // provided social class and skill type providers (typically from the manager).
@@ -34,11 +82,98 @@ namespace MARAS {
         // Pure function to compute temperament from SocialClass and SkillType directly.
         static Temperament ComputeTemperament(SocialClass socialClass, SkillType skillType);
 
+        // Apply per-cell overrides from a JSON file of the form { "<social class>": { "<skill type>":
+        // "<temperament>" } } on top of the built-in matrix. A missing file keeps the built-in matrix.
+        static bool LoadTemperamentMatrix(const std::string& path);
+
+        // Apply per-skill overrides from a JSON file of the form { "<skill>": "<skill type>" } or { "<skill>":
+        // { "type": "<skill type>", "weight": <number> } } on top of the built-in skill rules. A missing file keeps
+        // the built-in rules.
+        static bool LoadSkillRules(const std::string& path);
+
+        // Build the faction -> social class index from the FormCache faction lists (call after data load).
+        // Social class detection rebuilds it on its own if scripts edit the lists later.
+        static void BuildSocialClassIndex();
+
+        // Drop cached rich-clothing results for one actor (its worn equipment may have changed) or for everyone
+        static void InvalidateWornClothing(RE::FormID actorFormID);
+        static void ClearWornClothingCache();
+
     private:
         // Helper methods used internally by the determiner
-        static SocialClass DetermineSocialClassByFaction(RE::FormID npcFormID);
-        static std::optional<SkillType> DetermineSkillTypeByClass(RE::FormID npcFormID);
-        static SkillType DetermineSkillTypeBySkills(RE::FormID npcFormID);
+        static SocialClass DetermineSocialClassByFaction(const ActorSnapshot& snapshot);
+        static std::optional<SkillType> DetermineSkillTypeByClass(RE::FormID baseFormID, RE::FormID classFormID);
+        static SkillType DetermineSkillTypeBySkills(RE::FormID baseFormID,
+                                                    const std::array<float, kSkillCount>& skills);
+
+        // Memoized per actor base FormID. Temporary bases of leveled actors are recycled by the engine and are
+        // never cached.
+        static BaseAttributes GetBaseAttributes(const ActorSnapshot& snapshot);
+
+        // Rebuild the faction index if the faction lists changed since it was built, and drop memoized base
+        // attributes if the faction or class lists changed. Caller holds socialClassIndexMutex_.
+        static void RefreshSocialClassIndexLocked();
+        // Whether the actor wears an item with the rich clothing keyword; cached until the next equip or 3D load
+        static bool WearsRichClothing(RE::Actor* actor, RE::BGSKeyword* keyword);
+
+        static TemperamentMatrix temperamentMatrix_;
+        static SkillRuleTable skillRules_;
+
+        // Faction FormID -> highest social class among the faction lists containing it. The stamp fingerprints
+        // the lists the index was built from.
+        static std::mutex socialClassIndexMutex_;
+        static std::unordered_map<RE::FormID, SocialClass> socialClassByFaction_;
+        static std::optional<std::uint64_t> socialClassIndexStamp_;
+        // Fingerprint of the class lists the memoized skill types were derived from
+        static std::optional<std::uint64_t> skillClassListsStamp_;
+
+        // Actor base FormID -> BaseAttributes; cleared whenever the faction index is rebuilt or a class list changes
+        static std::mutex baseAttributesMutex_;
+        static std::unordered_map<RE::FormID, BaseAttributes> baseAttributes_;
+        static std::atomic<std::uint64_t> baseAttributeHits_;
+        static std::atomic<std::uint64_t> baseAttributeMisses_;
+
+        static std::mutex wornClothingMutex_;
+        static std::unordered_map<RE::FormID, bool> wornRichClothing_;
+    };
+
+    // Everything attribute detection reads from an actor, copied by NPCTypeDeterminer::SnapshotActor
+    struct ActorSnapshot {
+        RE::FormID formID = 0;
+        RE::FormID baseFormID = 0;
+        bool cacheableBase = false;       // not a recycled temporary base
+        std::uint64_t classListsStamp = 0;  // class list fingerprint when taken; stale results are not memoized
+
+        // Base results already memoized when the snapshot was taken; the base fields below are then left empty
+        std::optional<NPCTypeDeterminer::BaseAttributes> memoized;
+
+        bool hasFactions = false;
+        std::vector<RE::FormID> factionFormIDs;
+        RE::FormID classFormID = 0;  // 0 if the base has no class
+        bool hasSkills = false;      // false if the base does not expose actor values
+        std::array<float, NPCTypeDeterminer::kSkillCount> skills{};
+
+        bool wearsRichClothing = false;
+    };
+
+    // Drops an actor's cached rich-clothing result when it equips or unequips something, or its 3D (re)loads
+    // with its outfit.
+    class WornEquipmentEventSink : public RE::BSTEventSink<RE::TESEquipEvent>,
+                                   public RE::BSTEventSink<RE::TESObjectLoadedEvent> {
+    public:
+        static WornEquipmentEventSink* GetSingleton();
+
+        RE::BSEventNotifyControl ProcessEvent(const RE::TESEquipEvent* event,
+                                              RE::BSTEventSource<RE::TESEquipEvent>* source) override;
+        RE::BSEventNotifyControl ProcessEvent(const RE::TESObjectLoadedEvent* event,
+                                              RE::BSTEventSource<RE::TESObjectLoadedEvent>* source) override;
+
+    private:
+        WornEquipmentEventSink() = default;
+        WornEquipmentEventSink(const WornEquipmentEventSink&) = delete;
+        WornEquipmentEventSink(WornEquipmentEventSink&&) = delete;
+        WornEquipmentEventSink& operator=(const WornEquipmentEventSink&) = delete;
+        WornEquipmentEventSink& operator=(WornEquipmentEventSink&&) = delete;
     };
 
 }  // namespace MARAS
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <mutex>
 #include <unordered_set>
 
 namespace RE {
@@ -13,30 +14,33 @@ namespace MARAS {
     class PollingService {
     public:
         using FormID = RE::FormID;
-        using TimePoint = std::chrono::steady_clock::time_point;
 
         static PollingService& GetSingleton();
 
-        // Initialize the service and start polling
+        // Initialize the service and register its periodic jobs with FrameScheduler
         // Can be called multiple times (e.g., on game load) to reset state
         void Initialize();
 
-        // Shutdown the service
+        // Shutdown the service and cancel its jobs
         void Shutdown();
 
-        // Update loop - call this periodically (e.g., from a game event hook)
-        void Update();
-
         // Get current teammates from ProcessLists (exposed for external callers)
         std::unordered_set<FormID> GetCurrentTeammates();
 
         // Check if a specific actor is currently a player teammate
         bool IsPlayerTeammate(RE::Actor* actor);
 
+        // Queue an actor whose teammate state may have changed (package or load event). Safe to call from any
+        // thread; the actor is re-evaluated by the next teammate-events job.
+        void MarkTeammateCandidate(FormID formID);
+
     private:
         PollingService() = default;
 
+        void ScheduleJobs();
+
         // Polling logic
+        void ProcessTeammateCandidates();
         void CheckTeammateChanges();
         void CheckDayChanged();
 
@@ -48,19 +52,43 @@ namespace MARAS {
                                      const std::unordered_set<FormID>& removed);
         void SendDayChangeEvent(float newDay);
 
-        // Timing
-        TimePoint lastTeammateCheck_;
-        TimePoint lastDayCheck_;
-
         // State tracking
         std::unordered_set<FormID> previousTeammates_;
         float previousGameDay_ = -1.0f;
 
-        // Intervals (in milliseconds)
-        static constexpr std::chrono::milliseconds kTeammateCheckInterval{15000};  // 15 seconds
+        // Actors flagged by TeammateEventSink since the last teammate-events job
+        std::mutex candidatesMutex_;
+        std::unordered_set<FormID> teammateCandidates_;
+
+        // Job intervals (in milliseconds). Teammate changes are picked up from events; the full ProcessLists scan
+        // only reconciles changes no event reports (e.g. SetPlayerTeammate or faction edits from scripts).
+        static constexpr std::chrono::milliseconds kTeammateEventInterval{100};
+        static constexpr std::chrono::milliseconds kGlobalsFlushInterval{1000};
+        static constexpr std::chrono::milliseconds kTeammateCheckInterval{60000};  // 60 seconds
         static constexpr std::chrono::milliseconds kDayCheckInterval{60000};       // 60 seconds
+        static constexpr std::chrono::milliseconds kSlowJobJitter{5000};
 
         bool initialized_ = false;
     };
 
+    // Feeds PollingService with actors whose teammate state may have changed: any package start/change/end
+    // (follow packages come and go with recruiting/dismissing) and 3D load/unload.
+    class TeammateEventSink : public RE::BSTEventSink<RE::TESPackageEvent>,
+                              public RE::BSTEventSink<RE::TESObjectLoadedEvent> {
+    public:
+        static TeammateEventSink* GetSingleton();
+
+        RE::BSEventNotifyControl ProcessEvent(const RE::TESPackageEvent* event,
+                                              RE::BSTEventSource<RE::TESPackageEvent>* source) override;
+        RE::BSEventNotifyControl ProcessEvent(const RE::TESObjectLoadedEvent* event,
+                                              RE::BSTEventSource<RE::TESObjectLoadedEvent>* source) override;
+
+    private:
+        TeammateEventSink() = default;
+        TeammateEventSink(const TeammateEventSink&) = delete;
+        TeammateEventSink(TeammateEventSink&&) = delete;
+        TeammateEventSink& operator=(const TeammateEventSink&) = delete;
+        TeammateEventSink& operator=(TeammateEventSink&&) = delete;
+    };
+
 }  // namespace MARAS
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+
+#include "core/NPCAttributes.h"
+
+namespace MARAS::SkillRules {
+
+    // Skill-based skill type detection as plain math over the 18 skill levels. NPCTypeDeterminer reads the levels
+    // from the game and owns the (JSON-overridable) rule table; everything here is independent of the game.
+
+    inline constexpr std::size_t kSkillCount = 18;
+
+    // Skill indices in rule order: OneHanded, TwoHanded, Archery, Block, Smithing, HeavyArmor, LightArmor,
+    // Pickpocket, Lockpicking, Sneak, Alchemy, Speech, Alteration, Conjuration, Destruction, Illusion,
+    // Restoration, Enchanting
+    inline constexpr std::size_t kArcherySkill = 2;
+    inline constexpr std::size_t kLightArmorSkill = 6;
+    inline constexpr std::size_t kPickpocketSkill = 7;
+    inline constexpr std::size_t kLockpickingSkill = 8;
+
+    // How one skill counts in skill-based detection: its level is scaled by weight and the highest scaled skill
+    // decides the skill type. A rule without a type picks Ranger if Archery beats both Pickpocket and
+    // Lockpicking, else Rogue (the built-in Light Armor rule).
+    struct SkillRule {
+        std::optional<SkillType> type;
+        float weight = 1.0f;
+    };
+    using SkillRuleTable = std::array<SkillRule, kSkillCount>;
+    using SkillLevels = std::array<float, kSkillCount>;
+
+    // Skill type granted when a skill is the NPC's highest. Light Armor has no fixed type.
+    inline constexpr SkillRuleTable kDefaultSkillRules{{
+        {SkillType::Warrior},    // OneHanded
+        {SkillType::Warrior},    // TwoHanded
+        {SkillType::Ranger},     // Archery
+        {SkillType::Warrior},    // Block
+        {SkillType::Craftsman},  // Smithing
+        {SkillType::Warrior},    // HeavyArmor
+        {std::nullopt},          // LightArmor
+        {SkillType::Rogue},      // Pickpocket
+        {SkillType::Rogue},      // Lockpicking
+        {SkillType::Rogue},      // Sneak
+        {SkillType::Craftsman},  // Alchemy
+        {SkillType::Orator},     // Speech
+        {SkillType::Mage},       // Alteration
+        {SkillType::Mage},       // Conjuration
+        {SkillType::Mage},       // Destruction
+        {SkillType::Mage},       // Illusion
+        {SkillType::Mage},       // Restoration
+        {SkillType::Craftsman},  // Enchanting
+    }};
+
+    struct SkillPick {
+        std::size_t topSkill = 0;  // index of the highest weighted skill
+        SkillType type = SkillType::Warrior;
+    };
+
+    // Highest weighted skill (the first one wins ties) and the skill type its rule grants
+    SkillPick PickSkillType(const SkillLevels& skills, const SkillRuleTable& rules);
+
+}  // namespace MARAS::SkillRules
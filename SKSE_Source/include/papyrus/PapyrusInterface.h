@@ -10,6 +10,8 @@ namespace MARAS::PapyrusInterface {
     // Registration functions
     bool RegisterCandidate(RE::StaticFunctionTag*, RE::Actor* npc);
     bool UnregisterNPC(RE::StaticFunctionTag*, RE::Actor* npc);
+    std::vector<std::int32_t> RegisterCandidates(RE::StaticFunctionTag*, std::vector<RE::Actor*> npcs);
+    std::vector<RE::Actor*> RegisterLoadedCandidates(RE::StaticFunctionTag*);
 
     // Consolidated faction management - supports both enum and string type
     bool SetNpcCharacteristics(RE::StaticFunctionTag*, RE::Actor* npc, std::string factionType, std::int32_t rank);
@@ -22,6 +24,9 @@ namespace MARAS::PapyrusInterface {
     bool PromoteNPCToStatus(RE::StaticFunctionTag*, RE::Actor* npc, std::string statusType);
     bool PromoteNPCToStatusByEnum(RE::StaticFunctionTag*, RE::Actor* npc, std::int32_t statusEnum);
 
+    // Batched status transition for many NPCs at once; returns the number promoted
+    std::int32_t PromoteNPCsToStatus(RE::StaticFunctionTag*, std::vector<RE::Actor*> npcs, std::string statusType);
+
     // Consolidated bulk retrieval - supports both enum and string type
     std::vector<RE::Actor*> GetNPCsByStatus(RE::StaticFunctionTag*, std::string statusType);
     std::vector<RE::Actor*> GetNPCsByStatusEnum(RE::StaticFunctionTag*, std::int32_t statusEnum);
@@ -99,6 +104,11 @@ namespace MARAS::PapyrusInterface {
     float CalculateMarriageSuccessChance(RE::StaticFunctionTag*, RE::Actor* npc, float intimacyAdjustment,
                                          float mostGold, float housesOwned, float horsesOwned, float questsCompleted,
                                          float dungeonsCleared, float dragonSoulsCollected, bool playerKiller);
+    std::vector<float> CalculateMarriageSuccessChances(RE::StaticFunctionTag*, std::vector<RE::Actor*> npcs,
+                                                       std::vector<float> intimacyAdjustments, float mostGold,
+                                                       float housesOwned, float horsesOwned, float questsCompleted,
+                                                       float dungeonsCleared, float dragonSoulsCollected,
+                                                       bool playerKiller);
 
     // Registration function for SKSE
     bool RegisterPapyrusFunctions(RE::BSScript::IVirtualMachine* vm);
@@ -7,10 +7,13 @@
 #include "core/AffectionService.h"
 #include "core/BonusesService.h"
 #include "core/DialogueEventSink.h"
+#include "core/FormCache.h"
+#include "core/FrameScheduler.h"
 #include "core/HomeCellService.h"
 #include "core/LoggingService.h"
 #include "core/MarriageDifficulty.h"
 #include "core/NPCRelationshipManager.h"
+#include "core/NPCTypeDeterminer.h"
 #include "core/PackageOverrideService.h"
 #include "core/PlayerHouseService.h"
 #include "core/PollingService.h"
@@ -28,29 +31,6 @@ namespace MARAS {
 }
 
 namespace {
-    // Event sink for OnUpdate to drive polling service
-    class UpdateEventSink : public RE::BSTEventSink<RE::MenuOpenCloseEvent> {
-    public:
-        static UpdateEventSink* GetSingleton() {
-            static UpdateEventSink singleton;
-            return &singleton;
-        }
-
-        RE::BSEventNotifyControl ProcessEvent(const RE::MenuOpenCloseEvent*,
-                                              RE::BSTEventSource<RE::MenuOpenCloseEvent>*) override {
-            // Called frequently enough to drive our polling service
-            MARAS::PollingService::GetSingleton().Update();
-            return RE::BSEventNotifyControl::kContinue;
-        }
-
-    private:
-        UpdateEventSink() = default;
-        UpdateEventSink(const UpdateEventSink&) = delete;
-        UpdateEventSink(UpdateEventSink&&) = delete;
-        UpdateEventSink& operator=(const UpdateEventSink&) = delete;
-        UpdateEventSink& operator=(UpdateEventSink&&) = delete;
-    };
-
     std::shared_ptr<spdlog::logger> SetupLogging() {
         auto logDir = SKSE::log::log_directory();
         if (!logDir) {
@@ -100,6 +80,11 @@ namespace {
     void SaveCallback(SKSE::SerializationInterface* serialization) {
         auto& manager = MARAS::NPCRelationshipManager::GetSingleton();
 
+        // A decay pass sliced over frames would otherwise be saved half done and dropped by Revert on load
+        MARAS::AffectionService::GetSingleton().FinishPendingDecay();
+        // Push queued permanent changes to the faction ranks so the actors are saved with the same values
+        MARAS::AffectionService::GetSingleton().FlushAffectionChanges();
+
         if (!serialization->OpenRecord(MARAS::Serialization::kNPCRelationshipData,
                                        MARAS::Serialization::kDataVersion)) {
             MARAS_LOG_ERROR("Failed to open record for saving");
@@ -259,9 +244,11 @@ namespace {
         MARAS::SpouseAssetsService::GetSingleton().Revert();
         MARAS::LoggingService::GetSingleton().Revert();
         MARAS::PackageOverrideService::GetSingleton().Revert();  // clears in-memory registry; rebuilt by Papyrus on kPostLoadGame
+        MARAS::NPCTypeDeterminer::ClearWornClothingCache();
 
         // Load marriage difficulty configuration for new game
         MARAS::MarriageDifficulty::LoadConfig();
+        MARAS::MarriageDifficulty::InvalidatePlayerStanding();
 
         MARAS_LOG_INFO("Reverted NPC relationship data");
     }
@@ -290,6 +277,7 @@ SKSEPluginLoad(const LoadInterface* skse) {
                 switch (message->type) {
                     case SKSE::MessagingInterface::kPostLoad:
                         MARAS::PackageOverrideService::InstallHooks();
+                        MARAS::FrameScheduler::InstallHooks();
                         break;
 
                     case SKSE::MessagingInterface::kPreLoadGame:
@@ -304,6 +292,8 @@ SKSEPluginLoad(const LoadInterface* skse) {
 
                         // Load marriage difficulty configuration on game load
                         MARAS::MarriageDifficulty::LoadConfig();
+                        // Quest stages were restored from the save; rebuild player standing on the next query
+                        MARAS::MarriageDifficulty::InvalidatePlayerStanding();
 
                         // Initialize/reset polling service state to prevent false events from previous save
                         MARAS::PollingService::GetSingleton().Initialize();
@@ -315,6 +305,9 @@ SKSEPluginLoad(const LoadInterface* skse) {
                     case SKSE::MessagingInterface::kDataLoaded: {
                         MARAS_LOG_INFO("Data loaded successfully.");
 
+                        // Resolve every plugin form up front; everything below reads them through FormCache
+                        MARAS::FormCache::GetSingleton().WarmUp();
+
                         // Initialize the NPC relationship manager
                         auto& manager = MARAS::NPCRelationshipManager::GetSingleton();
 
@@ -328,6 +321,19 @@ SKSEPluginLoad(const LoadInterface* skse) {
                             MARAS_LOG_WARN("Failed to load NPC type overrides from {}", overrideFolder.string());
                         }
 
+                        // Optional per-cell overrides of the social class x skill type temperament matrix
+                        MARAS::NPCTypeDeterminer::LoadTemperamentMatrix(
+                            "Data/SKSE/Plugins/MARAS/temperamentMatrix.json");
+
+                        // Optional per-skill overrides for skill-based skill type detection
+                        MARAS::NPCTypeDeterminer::LoadSkillRules("Data/SKSE/Plugins/MARAS/skillRules.json");
+
+                        // Faction -> social class index used when registering NPCs
+                        MARAS::NPCTypeDeterminer::BuildSocialClassIndex();
+
+                        // Publishes batched permanent affection changes once per frame
+                        MARAS::AffectionService::GetSingleton().ScheduleJobs();
+
                         // Build the home/cell index (doors, persistent actors, furniture owners)
                         MARAS::HomeCellService::GetSingleton().BuildIndex();
 
@@ -352,16 +358,26 @@ SKSEPluginLoad(const LoadInterface* skse) {
                             scriptEventSourceHolder->AddEventSink<RE::TESQuestStageEvent>(
                                 MARAS::QuestStageEventSink::GetSingleton());
                             MARAS_LOG_INFO("Registered quest event sinks");
+
+                            scriptEventSourceHolder->AddEventSink<RE::TESPackageEvent>(
+                                MARAS::TeammateEventSink::GetSingleton());
+                            scriptEventSourceHolder->AddEventSink<RE::TESObjectLoadedEvent>(
+                                MARAS::TeammateEventSink::GetSingleton());
+                            MARAS_LOG_INFO("Registered teammate event sink");
+
+                            scriptEventSourceHolder->AddEventSink<RE::TESEquipEvent>(
+                                MARAS::WornEquipmentEventSink::GetSingleton());
+                            scriptEventSourceHolder->AddEventSink<RE::TESObjectLoadedEvent>(
+                                MARAS::WornEquipmentEventSink::GetSingleton());
+                            MARAS_LOG_INFO("Registered worn equipment event sink");
                         } else {
                             MARAS_LOG_ERROR("Failed to get ScriptEventSourceHolder for event sink registration");
                         }
 
-                        // Register update event sink for polling service
+                        // Register dialogue event sink
                         auto ui = RE::UI::GetSingleton();
                         if (ui) {
-                            ui->AddEventSink(UpdateEventSink::GetSingleton());
                             ui->AddEventSink<RE::MenuOpenCloseEvent>(MARAS::DialogueEventSink::GetSingleton());
-                            MARAS_LOG_INFO("Registered polling service update event sink");
                             MARAS_LOG_INFO("Registered dialogue event sink");
                         } else {
                             MARAS_LOG_ERROR("Failed to get UI singleton for event sink registration");
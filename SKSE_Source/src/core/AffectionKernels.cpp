@@ -0,0 +1,222 @@
+#include "core/AffectionKernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(__SSE2__)
+    #include <emmintrin.h>
+    #define MARAS_AFFECTION_SSE2 1
+#else
+    #define MARAS_AFFECTION_SSE2 0
+#endif
+
+namespace MARAS::AffectionKernels {
+
+    namespace {
+        // Scalar mirrors of minps/maxps (second operand wins on NaN), so both paths clamp NaN the same way
+        float MinPs(float a, float b) { return a < b ? a : b; }
+        float MaxPs(float a, float b) { return a > b ? a : b; }
+
+        // std::lround for the clamped range, built from truncation so the SIMD path can reproduce it exactly
+        std::int32_t RoundHalfAway(float value) {
+            const auto truncated = static_cast<std::int32_t>(value);
+            const float frac = value - static_cast<float>(truncated);
+            if (std::fabs(frac) >= 0.5f) {
+                return truncated + (value < 0.0f ? -1 : 1);
+            }
+            return truncated;
+        }
+
+        std::int32_t RowDeltaScalar(const float* amounts, std::uint16_t touched, const TypeBounds& bounds) {
+            // Summed as unsigned so an extreme per-type clamp wraps like the SIMD add instead of overflowing
+            std::uint32_t sum = 0;
+            for (std::size_t type = 0; type < kTypeCount; ++type) {
+                if (!(touched & (1u << type))) continue;
+
+                const float limited = MaxPs(MinPs(amounts[type], kMaxDailyMagnitude), -kMaxDailyMagnitude);
+                const auto clamped = std::clamp(RoundHalfAway(limited), bounds.minVal[type], bounds.maxVal[type]);
+                sum += static_cast<std::uint32_t>(clamped);
+            }
+            return static_cast<std::int32_t>(sum);
+        }
+
+        float PerDayRate(const DecayParams& params, std::uint8_t temperament) {
+            return temperament < params.perDayByTemperament.size() ? params.perDayByTemperament[temperament]
+                                                                   : params.defaultPerDay;
+        }
+
+        float DecayScalar(float daysSince, std::uint8_t temperament, std::uint8_t flags, const DecayParams& params) {
+            if (!(daysSince > params.daysBeforeDecay)) return 0.0f;
+            if (flags & kDecayFollowing) return params.followingBonus;
+            if (!(flags & kDecayLonely)) return 0.0f;
+
+            const float engaged = (flags & kDecayEngaged) ? params.engagedMultiplier : 1.0f;
+            const float mult = (params.spouseMultiplier * engaged) * params.decayMultiplier;
+            return -(PerDayRate(params, temperament) * mult);
+        }
+
+#if MARAS_AFFECTION_SSE2
+        // Per-lane select: mask ? a : b
+        __m128i Select(__m128i mask, __m128i a, __m128i b) {
+            return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+        }
+        __m128 Select(__m128 mask, __m128 a, __m128 b) {
+            return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+        }
+
+        __m128i RoundHalfAway(__m128 value) {
+            const __m128i truncated = _mm_cvttps_epi32(value);
+            const __m128 frac = _mm_sub_ps(value, _mm_cvtepi32_ps(truncated));
+            const __m128 absFrac = _mm_andnot_ps(_mm_set1_ps(-0.0f), frac);
+            const __m128i away = _mm_castps_si128(_mm_cmpge_ps(absFrac, _mm_set1_ps(0.5f)));
+            // +1 for positive values, -1 for negative ones
+            const __m128i negative = _mm_castps_si128(_mm_cmplt_ps(value, _mm_setzero_ps()));
+            const __m128i step = _mm_or_si128(negative, _mm_set1_epi32(1));
+            return _mm_add_epi32(truncated, _mm_and_si128(away, step));
+        }
+
+        // SSE2 has no pminsd/pmaxsd
+        __m128i ClampEpi32(__m128i value, __m128i lo, __m128i hi) {
+            value = Select(_mm_cmplt_epi32(value, lo), lo, value);
+            return Select(_mm_cmpgt_epi32(value, hi), hi, value);
+        }
+
+        void DailyDeltasSse2(const float* amounts, const std::uint16_t* touched, const TypeBounds& bounds,
+                             std::int32_t* out, std::size_t rows) {
+            constexpr std::size_t kLanes = 4;
+            constexpr std::size_t kChunks = kTypeCount / kLanes;
+
+            __m128i lo[kChunks];
+            __m128i hi[kChunks];
+            __m128i bits[kChunks];
+            for (std::size_t c = 0; c < kChunks; ++c) {
+                lo[c] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bounds.minVal.data() + c * kLanes));
+                hi[c] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bounds.maxVal.data() + c * kLanes));
+                const auto base = static_cast<int>(c * kLanes);
+                bits[c] = _mm_setr_epi32(1 << base, 1 << (base + 1), 1 << (base + 2), 1 << (base + 3));
+            }
+
+            const __m128 magnitude = _mm_set1_ps(kMaxDailyMagnitude);
+            const __m128 negMagnitude = _mm_set1_ps(-kMaxDailyMagnitude);
+
+            for (std::size_t row = 0; row < rows; ++row) {
+                const float* rowAmounts = amounts + row * kTypeCount;
+                const __m128i mask = _mm_set1_epi32(touched[row]);
+
+                __m128i sum = _mm_setzero_si128();
+                for (std::size_t c = 0; c < kChunks; ++c) {
+                    __m128 value = _mm_loadu_ps(rowAmounts + c * kLanes);
+                    value = _mm_max_ps(_mm_min_ps(value, magnitude), negMagnitude);
+                    const __m128i clamped = ClampEpi32(RoundHalfAway(value), lo[c], hi[c]);
+                    const __m128i active = _mm_cmpeq_epi32(_mm_and_si128(mask, bits[c]), bits[c]);
+                    sum = _mm_add_epi32(sum, _mm_and_si128(active, clamped));
+                }
+
+                // Horizontal add of the four lanes
+                sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+                sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+                out[row] = _mm_cvtsi128_si32(sum);
+            }
+        }
+
+        void LonelinessDecaySse2(const float* daysSince, const std::uint8_t* temperament, const std::uint8_t* flags,
+                                 const DecayParams& params, float* out, std::size_t count) {
+            constexpr std::size_t kLanes = 4;
+
+            const __m128 threshold = _mm_set1_ps(params.daysBeforeDecay);
+            const __m128 bonus = _mm_set1_ps(params.followingBonus);
+            const __m128 spouse = _mm_set1_ps(params.spouseMultiplier);
+            const __m128 engagedMult = _mm_set1_ps(params.engagedMultiplier);
+            const __m128 decayMult = _mm_set1_ps(params.decayMultiplier);
+            const __m128 defaultRate = _mm_set1_ps(params.defaultPerDay);
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 signBit = _mm_set1_ps(-0.0f);
+            const __m128i lonelyBit = _mm_set1_epi32(kDecayLonely);
+            const __m128i engagedBit = _mm_set1_epi32(kDecayEngaged);
+            const __m128i followingBit = _mm_set1_epi32(kDecayFollowing);
+
+            // Four bytes -> four int32 lanes
+            auto widen = [](const std::uint8_t* bytes) {
+                return _mm_setr_epi32(bytes[0], bytes[1], bytes[2], bytes[3]);
+            };
+            auto has = [](__m128i value, __m128i bit) {
+                return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(value, bit), bit));
+            };
+
+            std::size_t i = 0;
+            for (; i + kLanes <= count; i += kLanes) {
+                const __m128 days = _mm_loadu_ps(daysSince + i);
+                const __m128i temper = widen(temperament + i);
+                const __m128i flag = widen(flags + i);
+
+                // Temperament rate by compare-and-select over the (tiny) table
+                __m128 rate = defaultRate;
+                for (std::size_t t = 0; t < params.perDayByTemperament.size(); ++t) {
+                    const __m128 match =
+                        _mm_castsi128_ps(_mm_cmpeq_epi32(temper, _mm_set1_epi32(static_cast<int>(t))));
+                    rate = Select(match, _mm_set1_ps(params.perDayByTemperament[t]), rate);
+                }
+
+                const __m128 engaged = Select(has(flag, engagedBit), engagedMult, one);
+                const __m128 mult = _mm_mul_ps(_mm_mul_ps(spouse, engaged), decayMult);
+                const __m128 decay = _mm_xor_ps(_mm_mul_ps(rate, mult), signBit);
+
+                __m128 result = _mm_and_ps(has(flag, lonelyBit), decay);
+                result = Select(has(flag, followingBit), bonus, result);
+                result = _mm_and_ps(_mm_cmpgt_ps(days, threshold), result);
+                _mm_storeu_ps(out + i, result);
+            }
+
+            for (; i < count; ++i) {
+                out[i] = DecayScalar(daysSince[i], temperament[i], flags[i], params);
+            }
+        }
+#endif
+    }  // namespace
+
+    void DailyDeltasScalar(std::span<const float> amounts, std::span<const std::uint16_t> touched,
+                           const TypeBounds& bounds, std::span<std::int32_t> out) {
+        for (std::size_t row = 0; row < out.size(); ++row) {
+            out[row] = RowDeltaScalar(amounts.data() + row * kTypeCount, touched[row], bounds);
+        }
+    }
+
+    std::int32_t TypeDelta(float amount, std::int32_t minVal, std::int32_t maxVal) {
+        const float limited = MaxPs(MinPs(amount, kMaxDailyMagnitude), -kMaxDailyMagnitude);
+        return std::clamp(RoundHalfAway(limited), minVal, maxVal);
+    }
+
+    void DailyDeltas(std::span<const float> amounts, std::span<const std::uint16_t> touched, const TypeBounds& bounds,
+                     std::span<std::int32_t> out) {
+#if MARAS_AFFECTION_SSE2
+        DailyDeltasSse2(amounts.data(), touched.data(), bounds, out.data(), out.size());
+#else
+        DailyDeltasScalar(amounts, touched, bounds, out);
+#endif
+    }
+
+    void LonelinessDecayScalar(std::span<const float> daysSince, std::span<const std::uint8_t> temperament,
+                               std::span<const std::uint8_t> flags, const DecayParams& params, std::span<float> out) {
+        if (params.decayMultiplier <= 0.0f) {
+            std::fill(out.begin(), out.end(), 0.0f);
+            return;
+        }
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            out[i] = DecayScalar(daysSince[i], temperament[i], flags[i], params);
+        }
+    }
+
+    void LonelinessDecay(std::span<const float> daysSince, std::span<const std::uint8_t> temperament,
+                         std::span<const std::uint8_t> flags, const DecayParams& params, std::span<float> out) {
+#if MARAS_AFFECTION_SSE2
+        if (params.decayMultiplier <= 0.0f) {
+            std::fill(out.begin(), out.end(), 0.0f);
+            return;
+        }
+        LonelinessDecaySse2(daysSince.data(), temperament.data(), flags.data(), params, out.data(), out.size());
+#else
+        LonelinessDecayScalar(daysSince, temperament, flags, params, out);
+#endif
+    }
+
+}  // namespace MARAS::AffectionKernels
@@ -3,9 +3,12 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
-#include <cmath>
+#include <array>
+#include <cctype>
+#include <climits>
 
 #include "core/FormCache.h"
+#include "core/FrameScheduler.h"
 #include "core/NPCRelationshipManager.h"
 #include "utils/Common.h"
 #include "utils/EnumUtils.h"
@@ -33,7 +36,6 @@ namespace MARAS {
         // Loneliness decay configuration
         constexpr float kDaysBeforeDecayStarts = 2.0f;
         constexpr float kFollowingAffectionBonus = 6.0f;
-        constexpr float kDefaultDecayPerDay = 3.0f;
         constexpr float kNeverRecordedDaysSince = 999.0f;
 
         // Temperament-based decay rates
@@ -42,14 +44,36 @@ namespace MARAS {
         constexpr float kDecayRomantic = 4.0f;
         constexpr float kDecayDefault = 3.0f;
 
+        // Per-day decay indexed by Temperament
+        constexpr std::array<float, static_cast<std::size_t>(Temperament::_Count)> kDecayByTemperament = {
+            kDecayDefault,      // Proud
+            kDecayHumble,       // Humble
+            kDecayDefault,      // Jealous
+            kDecayRomantic,     // Romantic
+            kDecayIndependent,  // Independent
+        };
+
         // Spouse count multipliers for decay
-        constexpr int kSpouseCountHigh = 7;
-        constexpr int kSpouseCountMedium = 5;
-        constexpr int kSpouseCountLow = 3;
+        constexpr std::size_t kSpouseCountHigh = 7;
+        constexpr std::size_t kSpouseCountMedium = 5;
+        constexpr std::size_t kSpouseCountLow = 3;
         constexpr float kSpouseMultHigh = 0.5f;
         constexpr float kSpouseMultMedium = 0.6f;
         constexpr float kSpouseMultLow = 0.75f;
         constexpr float kEngagedDecayMultiplier = 0.5f;
+
+        // Day-change decay is processed this many NPCs at a time, one slice per scheduler tick
+        constexpr std::size_t kDecaySliceSize = 32;
+        constexpr std::chrono::milliseconds kDecaySliceInterval{50};
+        constexpr const char* kDecayJobName = "affection.decay";
+
+        // Pending permanent changes are published by a persistent job on the next scheduler tick
+        constexpr std::chrono::milliseconds kFlushInterval{50};
+        constexpr const char* kFlushJobName = "affection.flush";
+
+        constexpr std::string_view kLonelinessType = "loneliness";
+
+        char LowerAscii(char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); }
     }  // namespace
 
     AffectionService& AffectionService::GetSingleton() {
@@ -57,32 +81,122 @@ namespace MARAS {
         return instance;
     }
 
+    std::size_t AffectionService::TypeNameHash::operator()(std::string_view name) const noexcept {
+        // FNV-1a over the lowercased bytes
+        std::size_t hash = 14695981039346656037ull;
+        for (char c : name) {
+            hash ^= static_cast<unsigned char>(LowerAscii(c));
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    bool AffectionService::TypeNameEqual::operator()(std::string_view a, std::string_view b) const noexcept {
+        return a.size() == b.size() &&
+               std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) { return LowerAscii(x) == LowerAscii(y); });
+    }
+
+    AffectionService::AffectionTypeId AffectionService::FindType(std::string_view type) const {
+        if (lastTypeId_ != kInvalidAffectionType && type == lastTypeName_) {
+            return lastTypeId_;
+        }
+
+        auto it = typeIds_.find(type);
+        if (it == typeIds_.end()) return kInvalidAffectionType;
+
+        lastTypeName_.assign(type);
+        lastTypeId_ = it->second;
+        return it->second;
+    }
+
+    AffectionService::AffectionTypeId AffectionService::InternType(std::string_view type) {
+        if (auto id = FindType(type); id != kInvalidAffectionType) {
+            return id;
+        }
+
+        if (typeNames_.size() >= kInvalidAffectionType) {
+            MARAS_LOG_ERROR("Affection type '{}' not registered: limit of {} types reached", type,
+                            kInvalidAffectionType);
+            return kInvalidAffectionType;
+        }
+
+        auto id = static_cast<AffectionTypeId>(typeNames_.size());
+        typeNames_.push_back(Utils::ToLower(type));
+        typeIds_.emplace(typeNames_.back(), id);
+        clampByType_.emplace_back();
+        if (id < kKernelAffectionTypes) {
+            MARAS_LOG_DEBUG("Registered affection type '{}' as {}", typeNames_.back(), id);
+        } else {
+            MARAS_LOG_INFO("Registered affection type '{}' as {} (past the {} kernel types, using the scalar path)",
+                           typeNames_.back(), id, kKernelAffectionTypes);
+        }
+        return id;
+    }
+
     void AffectionService::AddAffection(FormID npcFormID, float amount, const std::string& type) {
-        if (!ValidateActor(npcFormID, "AddAffection")) {
+        AddAffectionById(npcFormID, amount, InternType(type));
+    }
+
+    std::uint32_t AffectionService::FindRow(FormID npcFormID) const {
+        auto slot = NPCRelationshipManager::GetSingleton().GetRosterSlot(npcFormID);
+        return store_.Holds(slot, npcFormID) ? slot : kNoRow;
+    }
+
+    std::uint32_t AffectionService::BindRow(FormID npcFormID) {
+        auto slot = NPCRelationshipManager::GetSingleton().GetRosterSlot(npcFormID);
+        if (slot == NPCRoster::kInvalidPos) return kNoRow;
+        store_.Bind(slot, npcFormID);
+        return slot;
+    }
+
+    void AffectionService::AddAffectionById(FormID npcFormID, float amount, AffectionTypeId typeId) {
+        if (typeId == kInvalidAffectionType || !ValidateActor(npcFormID, "AddAffection")) {
             return;
         }
 
-        auto key = NormalizeType(type);
-        dailyAffection_[npcFormID][key] += amount;
-
         // Record that this NPC received affection today
         RecordAffectionInteraction(npcFormID);
 
-        MARAS_LOG_DEBUG("AddAffection: NPC {:08X} += {} ({}) (daily now {})", npcFormID, amount, key,
-                        dailyAffection_[npcFormID][key]);
+        auto row = BindRow(npcFormID);
+        if (row == kNoRow) {
+            auto& daily = unbound_[npcFormID].daily;
+            auto it = std::find_if(daily.begin(), daily.end(), [typeId](const auto& e) { return e.first == typeId; });
+            if (it != daily.end()) {
+                it->second += amount;
+            } else {
+                daily.emplace_back(typeId, amount);
+            }
+            MARAS_LOG_DEBUG("AddAffection: NPC {:08X} is not registered, keeping {} ({}) until it is", npcFormID,
+                            amount, typeNames_[typeId]);
+            return;
+        }
+
+        store_.AddDaily(row, typeId, amount);
+
+        MARAS_LOG_DEBUG("AddAffection: NPC {:08X} += {} ({}) (daily now {})", npcFormID, amount, typeNames_[typeId],
+                        store_.DailyAmount(row, typeId));
     }
 
     float AffectionService::GetDailyAffection(FormID npcFormID, const std::string& type) const {
-        auto key = NormalizeType(type);
-        auto it = dailyAffection_.find(npcFormID);
-        if (it == dailyAffection_.end()) return 0.0f;
-        auto it2 = it->second.find(key);
-        return (it2 == it->second.end()) ? 0.0f : it2->second;
+        auto typeId = FindType(type);
+        if (typeId == kInvalidAffectionType) return 0.0f;
+        auto row = FindRow(npcFormID);
+        if (row != kNoRow) return store_.DailyAmount(row, typeId);
+
+        auto it = unbound_.find(npcFormID);
+        if (it == unbound_.end()) return 0.0f;
+        for (const auto& [id, amount] : it->second.daily) {
+            if (id == typeId) return amount;
+        }
+        return 0.0f;
     }
 
     int AffectionService::GetPermanentAffection(FormID npcFormID) const {
-        auto it = permanentAffection_.find(npcFormID);
-        return (it == permanentAffection_.end()) ? 0 : it->second;
+        auto row = FindRow(npcFormID);
+        if (row != kNoRow) return store_.Permanent(row);
+
+        auto it = unbound_.find(npcFormID);
+        return (it == unbound_.end()) ? 0 : it->second.permanent;
     }
 
     void AffectionService::SetPermanentAffection(FormID npcFormID, int amount) {
@@ -92,85 +206,169 @@ namespace MARAS {
         }
 
         int clamped = ClampAffection(amount);
-        int oldVal = GetPermanentAffection(npcFormID);
 
-        std::string oldThreshold = GetAffectionThreshold(oldVal);
-        std::string newThreshold = GetAffectionThreshold(clamped);
+        auto row = BindRow(npcFormID);
+        if (row == kNoRow) {
+            // No row to queue on: keep the value by FormID and publish it right away
+            auto& entry = unbound_[npcFormID];
+            const int oldVal = entry.permanent;
+            entry.permanent = clamped;
+            entry.hasPermanent = true;
+            MARAS_LOG_INFO("SetPermanentAffection: unregistered NPC {:08X} = {} (clamped from {})", npcFormID,
+                           clamped, amount);
+
+            UpdateAffectionFaction(actor, npcFormID, clamped);
+            std::string oldThreshold = GetAffectionThreshold(oldVal);
+            std::string newThreshold = GetAffectionThreshold(clamped);
+            if (oldThreshold != newThreshold) {
+                SendAffectionChangeEvent(npcFormID, newThreshold, clamped - oldVal);
+            }
+            return;
+        }
 
-        // Store new value
-        permanentAffection_[npcFormID] = clamped;
+        // Store new value; faction rank and threshold event are published by FlushAffectionChanges
+        store_.SetPermanent(row, clamped);
         MARAS_LOG_INFO("SetPermanentAffection: NPC {:08X} = {} (clamped from {})", npcFormID, clamped, amount);
 
-        // Update faction rank
-        UpdateAffectionFaction(actor, npcFormID, clamped);
+        if (store_.MarkDirty(row)) {
+            dirtyRows_.push_back(row);
+        }
+    }
+
+    void AffectionService::ScheduleJobs() {
+        FrameScheduler::GetSingleton().Schedule(kFlushJobName, kFlushInterval, [this] { FlushAffectionChanges(); });
+    }
+
+    void AffectionService::FlushAffectionChanges() {
+        if (dirtyRows_.empty()) return;
+
+        auto rows = std::move(dirtyRows_);
+        dirtyRows_.clear();
 
-        // Send event if threshold changed
-        if (oldThreshold != newThreshold) {
-            SendAffectionChangeEvent(npcFormID, newThreshold, clamped - oldVal);
+        std::size_t published = 0;
+        for (auto row : rows) {
+            // Skip rows reset (NPC unregistered) or already published through a duplicate entry
+            if (row >= store_.RowCount() || !store_.IsDirty(row)) continue;
+
+            const FormID npcFormID = store_.Owner(row);
+            const int oldVal = store_.Published(row);
+            const int newVal = store_.Permanent(row);
+            store_.Publish(row);
+
+            auto actor = ValidateActor(npcFormID, "FlushAffectionChanges");
+            if (!actor) continue;
+
+            // Update faction rank
+            UpdateAffectionFaction(actor, npcFormID, newVal);
+            ++published;
+
+            // Send event if threshold changed
+            std::string oldThreshold = GetAffectionThreshold(oldVal);
+            std::string newThreshold = GetAffectionThreshold(newVal);
+            if (oldThreshold != newThreshold) {
+                SendAffectionChangeEvent(npcFormID, newThreshold, newVal - oldVal);
+            }
         }
+
+        MARAS_LOG_DEBUG("FlushAffectionChanges: published {} NPCs", published);
     }
 
     void AffectionService::SetAffectionMinMax(const std::string& type, int minVal, int maxVal) {
-        auto key = NormalizeType(type);
-        minMaxByType_[key] = {minVal, maxVal};
-        MARAS_LOG_INFO("SetAffectionMinMax: {} -> [{}, {}]", key, minVal, maxVal);
+        auto typeId = InternType(type);
+        if (typeId == kInvalidAffectionType) return;
+        clampByType_[typeId] = {true, minVal, maxVal};
+        MARAS_LOG_INFO("SetAffectionMinMax: {} -> [{}, {}]", typeNames_[typeId], minVal, maxVal);
     }
 
     bool AffectionService::HasMinMaxForType(const std::string& type) const {
-        auto key = NormalizeType(type);
-        return minMaxByType_.find(key) != minMaxByType_.end();
+        auto typeId = FindType(type);
+        return typeId != kInvalidAffectionType && clampByType_[typeId].set;
     }
 
     std::pair<int, int> AffectionService::GetMinMaxForType(const std::string& type) const {
-        auto key = NormalizeType(type);
-        auto it = minMaxByType_.find(key);
-        if (it == minMaxByType_.end()) return {INT_MIN, INT_MAX};
-        return it->second;
+        auto typeId = FindType(type);
+        if (typeId == kInvalidAffectionType || !clampByType_[typeId].set) return {INT_MIN, INT_MAX};
+        return {clampByType_[typeId].minVal, clampByType_[typeId].maxVal};
     }
 
     void AffectionService::ApplyDailyAffectionsForAll() {
-        auto& manager = NPCRelationshipManager::GetSingleton();
-        auto all = manager.GetAllRegisteredNPCs();
+        // Deltas for every row in one batch; rows with no touched type come out as 0
+        std::vector<std::int32_t> deltas(store_.RowCount());
+        AffectionKernels::DailyDeltas(store_.DailyColumn(), store_.TouchedColumn(), BuildTypeBounds(), deltas);
 
-        for (auto npcFormID : all) {
-            auto it = dailyAffection_.find(npcFormID);
-            if (it == dailyAffection_.end()) continue;
+        // Rows are roster slots, so this is one pass over the store; a row's owner is always a registered NPC
+        // because unregistering clears the row first
+        for (std::uint32_t row = 0; row < store_.RowCount(); ++row) {
+            const FormID npcFormID = store_.Owner(row);
+            const auto* spilled = store_.Spill(row);
+            if (npcFormID == 0 || (store_.Touched(row) == 0 && !spilled)) continue;
 
-            int original = GetPermanentAffection(npcFormID);
-            int deltaTotal = CalculateTotalDailyDelta(it->second);
+            int original = store_.Permanent(row);
+            std::int64_t deltaTotal = deltas[row];
+            if (spilled) deltaTotal += SpillDelta(row);
 
             if (deltaTotal != 0) {
-                int updated = ClampAffection(original + deltaTotal);
+                int updated = static_cast<int>(std::clamp<std::int64_t>(original + deltaTotal, kAffectionMin,
+                                                                         kAffectionMax));
                 SetPermanentAffection(npcFormID, updated);
                 MARAS_LOG_INFO("Applied daily affection for NPC {:08X}: {} -> {} (delta {})", npcFormID, original,
                                updated, updated - original);
             }
 
             // Clear daily after applying
-            it->second.clear();
+            store_.ClearDaily(row);
         }
     }
 
     bool AffectionService::Save(SKSE::SerializationInterface* serialization) const {
         if (!serialization) return false;
 
+        // Record layout is unchanged from the map-based store: (formID, amount) pairs, then (formID, day) pairs
+        std::uint32_t count = 0;
+        std::uint32_t dayCount = 0;
+        for (std::uint32_t row = 0; row < store_.RowCount(); ++row) {
+            if (store_.Owner(row) == 0) continue;
+            if (store_.HasPermanent(row)) ++count;
+            if (store_.LastDay(row) != AffectionStore::kNeverRecorded) ++dayCount;
+        }
+        for (const auto& [formID, entry] : unbound_) {
+            if (entry.hasPermanent) ++count;
+            if (entry.lastDay != AffectionStore::kNeverRecorded) ++dayCount;
+        }
+
         // Write permanent affection count
-        std::uint32_t count = static_cast<std::uint32_t>(permanentAffection_.size());
         if (!serialization->WriteRecordData(count)) return false;
 
-        for (const auto& [formID, amount] : permanentAffection_) {
+        for (std::uint32_t row = 0; row < store_.RowCount(); ++row) {
+            if (store_.Owner(row) == 0 || !store_.HasPermanent(row)) continue;
+            const FormID formID = store_.Owner(row);
+            const int amount = store_.Permanent(row);
             if (!serialization->WriteRecordData(formID) || !serialization->WriteRecordData(amount)) return false;
         }
+        for (const auto& [formID, entry] : unbound_) {
+            if (!entry.hasPermanent) continue;
+            if (!serialization->WriteRecordData(formID) || !serialization->WriteRecordData(entry.permanent)) {
+                return false;
+            }
+        }
 
         MARAS_LOG_INFO("Saved {} permanent affection records", count);
 
         // Write last affection day count
-        std::uint32_t dayCount = static_cast<std::uint32_t>(lastAffectionDay_.size());
         if (!serialization->WriteRecordData(dayCount)) return false;
 
-        for (const auto& [formID, day] : lastAffectionDay_) {
+        for (std::uint32_t row = 0; row < store_.RowCount(); ++row) {
+            if (store_.Owner(row) == 0 || store_.LastDay(row) == AffectionStore::kNeverRecorded) continue;
+            const FormID formID = store_.Owner(row);
+            const float day = store_.LastDay(row);
             if (!serialization->WriteRecordData(formID) || !serialization->WriteRecordData(day)) return false;
         }
+        for (const auto& [formID, entry] : unbound_) {
+            if (entry.lastDay == AffectionStore::kNeverRecorded) continue;
+            if (!serialization->WriteRecordData(formID) || !serialization->WriteRecordData(entry.lastDay)) {
+                return false;
+            }
+        }
 
         MARAS_LOG_INFO("Saved {} last affection day records", dayCount);
 
@@ -186,6 +384,9 @@ namespace MARAS {
 
         Revert();
 
+        // Rows are addressed by roster slot, which relies on the NPCR record having been loaded before this one
+        std::uint32_t loaded = 0;
+
         // Load permanent affection
         std::uint32_t count = 0;
         if (!serialization->ReadRecordData(count)) return false;
@@ -206,10 +407,27 @@ namespace MARAS {
                 continue;
             }
 
-            permanentAffection_[newFormID] = amount;
+            auto row = BindRow(newFormID);
+            if (row == kNoRow) {
+                // Kept by FormID so it follows the NPC if it is registered later
+                auto& entry = unbound_[newFormID];
+                entry.permanent = amount;
+                entry.hasPermanent = true;
+                ++loaded;
+                continue;
+            }
+            // Take the saved value as the event baseline, but rewrite the faction rank on the next flush in case
+            // the save was written before a pending change reached it
+            store_.SetPermanent(row, amount);
+            store_.Publish(row);
+            if (store_.MarkDirty(row)) {
+                dirtyRows_.push_back(row);
+            }
+            ++loaded;
         }
 
-        MARAS_LOG_INFO("Loaded {} permanent affection records", permanentAffection_.size());
+        MARAS_LOG_INFO("Loaded {} permanent affection records", loaded);
+        loaded = 0;
 
         // Load last affection days
         std::uint32_t dayCount = 0;
@@ -237,10 +455,16 @@ namespace MARAS {
                 continue;
             }
 
-            lastAffectionDay_[newFormID] = day;
+            auto row = BindRow(newFormID);
+            if (row == kNoRow) {
+                unbound_[newFormID].lastDay = day;
+            } else {
+                store_.SetLastDay(row, day);
+            }
+            ++loaded;
         }
 
-        MARAS_LOG_INFO("Loaded {} last affection day records", lastAffectionDay_.size());
+        MARAS_LOG_INFO("Loaded {} last affection day records", loaded);
 
         // Load decay multiplier (optional for backwards compatibility)
         if (!serialization->ReadRecordData(decayMultiplier_)) {
@@ -254,21 +478,53 @@ namespace MARAS {
     }
 
     void AffectionService::Revert() {
-        permanentAffection_.clear();
-        dailyAffection_.clear();
-        minMaxByType_.clear();
-        lastAffectionDay_.clear();
+        if (decayPass_.active) {
+            FrameScheduler::GetSingleton().Cancel(kDecayJobName);
+            MARAS_LOG_INFO("Dropped affection decay pass with {} roster slots left",
+                           decayPass_.slotCount - decayPass_.next);
+        }
+        decayPass_ = DecayPass{};
+
+        dirtyRows_.clear();
+
+        store_.Clear();
+        unbound_.clear();
+        std::fill(clampByType_.begin(), clampByType_.end(), TypeClamp{});
         decayMultiplier_ = 1.0f;
         MARAS_LOG_INFO("Reverted affection service state");
     }
 
     void AffectionService::RemoveNPCData(FormID npcFormID) {
-        permanentAffection_.erase(npcFormID);
-        dailyAffection_.erase(npcFormID);
-        lastAffectionDay_.erase(npcFormID);
+        unbound_.erase(npcFormID);
+        auto row = FindRow(npcFormID);
+        if (row == kNoRow) return;
+        store_.Reset(row);
         MARAS_LOG_DEBUG("Removed affection data for NPC {:08X}", npcFormID);
     }
 
+    void AffectionService::AdoptNPCData(FormID npcFormID) {
+        auto it = unbound_.find(npcFormID);
+        if (it == unbound_.end()) return;
+
+        auto row = BindRow(npcFormID);
+        if (row == kNoRow) return;
+
+        const UnboundAffection entry = std::move(it->second);
+        unbound_.erase(it);
+
+        if (entry.hasPermanent) {
+            store_.SetPermanent(row, entry.permanent);
+            store_.Publish(row);  // faction rank was already published while unbound
+        }
+        if (entry.lastDay != AffectionStore::kNeverRecorded) {
+            store_.SetLastDay(row, entry.lastDay);
+        }
+        for (const auto& [typeId, amount] : entry.daily) {
+            store_.AddDaily(row, typeId, amount);
+        }
+        MARAS_LOG_DEBUG("Moved affection kept for NPC {:08X} into its roster row", npcFormID);
+    }
+
     float AffectionService::GetMultiplierForValue(int permanentAffection) const {
         if (permanentAffection >= kThresholdHappy) {
             return kMultiplierHappy;
@@ -289,8 +545,13 @@ namespace MARAS {
 
     void AffectionService::RecordAffectionInteraction(FormID npcFormID) {
         auto calendar = RE::Calendar::GetSingleton();
-        if (calendar) {
-            lastAffectionDay_[npcFormID] = calendar->GetDaysPassed();
+        if (!calendar) return;
+
+        auto row = BindRow(npcFormID);
+        if (row != kNoRow) {
+            store_.SetLastDay(row, calendar->GetDaysPassed());
+        } else {
+            unbound_[npcFormID].lastDay = calendar->GetDaysPassed();
         }
     }
 
@@ -299,41 +560,163 @@ namespace MARAS {
         if (!calendar) return 0.0f;
 
         float currentDay = calendar->GetDaysPassed();
-        auto it = lastAffectionDay_.find(npcFormID);
-        if (it == lastAffectionDay_.end()) {
+        auto row = FindRow(npcFormID);
+        float lastDay = AffectionStore::kNeverRecorded;
+        if (row != kNoRow) {
+            lastDay = store_.LastDay(row);
+        } else if (auto it = unbound_.find(npcFormID); it != unbound_.end()) {
+            lastDay = it->second.lastDay;
+        }
+        if (lastDay == AffectionStore::kNeverRecorded) {
             // Never recorded, assume it's been a while
             return kNeverRecordedDaysSince;
         }
 
-        return currentDay - it->second;
+        return currentDay - lastDay;
     }
 
-    void AffectionService::OnDayChanged() {
+    void AffectionService::OnDayChanged(std::function<void()> onComplete) {
+        // A pass still running from the previous day change is finished first so no NPC misses a day
+        if (decayPass_.active) {
+            MARAS_LOG_WARN("Day changed while previous decay pass was running, finishing it now");
+            RunDecaySlice(decayPass_.slotCount);
+        }
+
+        auto calendar = RE::Calendar::GetSingleton();
+        if (!calendar) {
+            MARAS_LOG_WARN("OnDayChanged: Calendar unavailable, skipping affection decay");
+            if (onComplete) onComplete();
+            return;
+        }
+
         auto& manager = NPCRelationshipManager::GetSingleton();
-        auto allNPCs = manager.GetAllRegisteredNPCs();
 
-        MARAS_LOG_INFO("Processing affection decay for {} NPCs on day change", allNPCs.size());
+        decayPass_ = DecayPass{};
+        decayPass_.active = true;
+        decayPass_.currentDay = calendar->GetDaysPassed();
+        decayPass_.params = BuildDecayParams(manager.GetMarriedCount());
+        decayPass_.slotCount = manager.GetRosterSlotCount();
+        decayPass_.started = std::chrono::steady_clock::now();
+        decayPass_.onComplete = std::move(onComplete);
+
+        MARAS_LOG_INFO("Processing affection decay for {} NPCs on day change", manager.GetTotalRegisteredCount());
+
+        // Small rosters finish in the first slice; larger ones continue on later frames
+        if (!RunDecaySlice(kDecaySliceSize)) {
+            FrameScheduler::GetSingleton().Schedule(kDecayJobName, kDecaySliceInterval,
+                                                    [this] { RunDecaySlice(kDecaySliceSize); });
+        }
+    }
+
+    void AffectionService::FinishPendingDecay() {
+        if (!decayPass_.active) return;
+        MARAS_LOG_INFO("Finishing affection decay pass with {} roster slots left before save",
+                       decayPass_.slotCount - decayPass_.next);
+        RunDecaySlice(decayPass_.slotCount);
+    }
 
-        for (auto npcFormID : allNPCs) {
-            float daysSince = GetDaysSinceLastAffection(npcFormID);
+    bool AffectionService::RunDecaySlice(std::size_t maxCount) {
+        if (!decayPass_.active) return true;
 
-            // Only apply decay if no affection received for more than the threshold
-            if (daysSince <= kDaysBeforeDecayStarts) {
+        auto sliceStart = std::chrono::steady_clock::now();
+        auto& manager = NPCRelationshipManager::GetSingleton();
+        const auto lonelinessType = InternType(kLonelinessType);
+
+        // Walk roster slots in order; the NPC record and its affection row share the slot index. The slice's
+        // inputs are gathered into columns and the loneliness affection of all of them computed in one batch.
+        const std::size_t first = decayPass_.next;
+        const std::size_t last = std::min(decayPass_.slotCount, first + maxCount);
+        const std::size_t capacity = last - first;
+
+        std::vector<FormID> npcs;
+        std::vector<float> daysSince;
+        std::vector<std::uint8_t> temperament;
+        std::vector<std::uint8_t> flags;
+        npcs.reserve(capacity);
+        daysSince.reserve(capacity);
+        temperament.reserve(capacity);
+        flags.reserve(capacity);
+
+        for (std::size_t slot = first; slot < last; ++slot) {
+            const auto row = static_cast<std::uint32_t>(slot);
+
+            // Free slot, or NPC unregistered since the pass started
+            const auto* npcData = manager.GetNPCDataBySlot(row);
+            if (!npcData) {
                 continue;
             }
+            const FormID npcFormID = npcData->formID;
+
+            const bool recorded =
+                store_.Holds(row, npcFormID) && store_.LastDay(row) != AffectionStore::kNeverRecorded;
+            const float days = recorded ? decayPass_.currentDay - store_.LastDay(row) : kNeverRecordedDaysSince;
+
+            std::uint8_t npcFlags = 0;
+            if (npcData->status == RelationshipStatus::Married) {
+                npcFlags |= AffectionKernels::kDecayLonely;
+            } else if (npcData->status == RelationshipStatus::Engaged) {
+                npcFlags |= AffectionKernels::kDecayLonely | AffectionKernels::kDecayEngaged;
+            }
+
+            // Followers gain affection instead; the actor lookup is only needed once decay would start
+            if (days > kDaysBeforeDecayStarts) {
+                auto actor = RE::TESForm::LookupByID<RE::Actor>(npcFormID);
+                if (actor && actor->IsPlayerTeammate()) {
+                    npcFlags |= AffectionKernels::kDecayFollowing;
+                }
+            }
 
-            // Check if NPC is currently following (teammate)
-            auto actor = RE::TESForm::LookupByID<RE::Actor>(npcFormID);
-            bool isFollowing = actor && actor->IsPlayerTeammate();
+            npcs.push_back(npcFormID);
+            daysSince.push_back(days);
+            temperament.push_back(static_cast<std::uint8_t>(npcData->temperament));
+            flags.push_back(npcFlags);
+        }
 
-            float lonelinessAffection = CalculateLonelinessDecay(npcFormID, isFollowing);
+        std::vector<float> loneliness(npcs.size());
+        AffectionKernels::LonelinessDecay(daysSince, temperament, flags, decayPass_.params, loneliness);
 
-            if (lonelinessAffection != 0.0f) {
-                AddAffection(npcFormID, lonelinessAffection, "loneliness");
+        for (std::size_t i = 0; i < npcs.size(); ++i) {
+            if (loneliness[i] != 0.0f) {
+                AddAffectionById(npcs[i], loneliness[i], lonelinessType);
+                ++decayPass_.applied;
                 MARAS_LOG_DEBUG("Applied loneliness affection {} to NPC {:08X} (days since: {}, following: {})",
-                                lonelinessAffection, npcFormID, daysSince, isFollowing);
+                                loneliness[i], npcs[i], daysSince[i],
+                                (flags[i] & AffectionKernels::kDecayFollowing) != 0);
             }
         }
+
+        const std::size_t visited = npcs.size();
+        decayPass_.next = last;
+        decayPass_.visited += visited;
+
+        auto elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - sliceStart);
+        decayPass_.busy += elapsed;
+        ++decayPass_.slices;
+        MARAS_LOG_DEBUG("Affection decay slice {}: {} NPCs in {} us ({}/{} slots done)", decayPass_.slices, visited,
+                        elapsed.count(), last, decayPass_.slotCount);
+
+        if (decayPass_.next < decayPass_.slotCount) {
+            return false;
+        }
+
+        FinishDecayPass();
+        return true;
+    }
+
+    void AffectionService::FinishDecayPass() {
+        DecayPass pass = std::move(decayPass_);
+        decayPass_ = DecayPass{};
+        FrameScheduler::GetSingleton().Cancel(kDecayJobName);
+
+        auto wall = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                                          pass.started);
+        MARAS_LOG_INFO("Affection decay finished: {} of {} NPCs affected, {} slices, {} us busy over {} ms",
+                       pass.applied, pass.visited, pass.slices, pass.busy.count(), wall.count());
+
+        if (pass.onComplete) {
+            pass.onComplete();
+        }
     }
 
     void AffectionService::SetDecayMultiplier(float multiplier) {
@@ -353,8 +736,6 @@ namespace MARAS {
         return actor;
     }
 
-    std::string AffectionService::NormalizeType(const std::string& type) { return Utils::ToLower(type); }
-
     std::string AffectionService::GetAffectionThreshold(int affectionValue) {
         if (affectionValue >= kThresholdHappy) return "happy";
         if (affectionValue >= kThresholdContent) return "content";
@@ -387,91 +768,50 @@ namespace MARAS {
         }
     }
 
-    int AffectionService::CalculateTotalDailyDelta(const std::unordered_map<std::string, float>& dailyByType) const {
-        int deltaTotal = 0;
-
-        for (const auto& [type, value] : dailyByType) {
-            int applied = static_cast<int>(std::lround(value));
-
-            // Clamp if min/max configured for this type
-            auto mmIt = minMaxByType_.find(type);
-            if (mmIt != minMaxByType_.end()) {
-                applied = std::clamp(applied, mmIt->second.first, mmIt->second.second);
-            }
-
-            deltaTotal += applied;
-            MARAS_LOG_DEBUG("CalculateTotalDailyDelta: type {} daily {} -> applied {}", type, value, applied);
+    AffectionKernels::TypeBounds AffectionService::BuildTypeBounds() const {
+        AffectionKernels::TypeBounds bounds;
+        for (std::size_t typeId = 0; typeId < kKernelAffectionTypes; ++typeId) {
+            const bool set = typeId < clampByType_.size() && clampByType_[typeId].set;
+            bounds.minVal[typeId] = set ? clampByType_[typeId].minVal : INT_MIN;
+            bounds.maxVal[typeId] = set ? clampByType_[typeId].maxVal : INT_MAX;
         }
-
-        return deltaTotal;
+        return bounds;
     }
 
-    float AffectionService::CalculateLonelinessDecay(FormID npcFormID, bool isFollowing) const {
-        // If decay is disabled (multiplier = 0), return 0
-        if (decayMultiplier_ <= 0.0f) {
-            return 0.0f;
-        }
+    std::int32_t AffectionService::SpillDelta(std::uint32_t row) const {
+        const auto* spilled = store_.Spill(row);
+        if (!spilled) return 0;
 
-        // If following player, they gain affection instead of losing it
-        if (isFollowing) {
-            MARAS_LOG_INFO("NPC {:08X} is following player, applying positive loneliness affection", npcFormID);
-            return kFollowingAffectionBonus;
+        // Summed as unsigned, matching the kernel rows
+        std::uint32_t sum = 0;
+        for (const auto& [typeId, amount] : *spilled) {
+            const auto& clamp = clampByType_[typeId];
+            sum += static_cast<std::uint32_t>(AffectionKernels::TypeDelta(amount, clamp.set ? clamp.minVal : INT_MIN,
+                                                                          clamp.set ? clamp.maxVal : INT_MAX));
         }
+        return static_cast<std::int32_t>(sum);
+    }
 
-        // Get NPC's temperament
-        auto& manager = NPCRelationshipManager::GetSingleton();
-        auto npcData = manager.GetNPCData(npcFormID);
-        if (!npcData) {
-            MARAS_LOG_WARN("No NPC data found for {:08X}, using default decay", npcFormID);
-            return -(kDefaultDecayPerDay * decayMultiplier_);
-        }
-        if (npcData->status != RelationshipStatus::Married && npcData->status != RelationshipStatus::Engaged) {
-            // Only married and engaged NPCs experience loneliness decay
-            return 0.0f;
-        }
-
-        // Base decay per day based on temperament
-        float perDay = kDecayDefault;
-        switch (npcData->temperament) {
-            case Temperament::Independent:
-                perDay = kDecayIndependent;
-                break;
-            case Temperament::Humble:
-                perDay = kDecayHumble;
-                break;
-            case Temperament::Romantic:
-                perDay = kDecayRomantic;
-                break;
-            default:
-                perDay = kDecayDefault;
-                break;
-        }
-
-        // Apply multiplier based on spouse count
-        int spouseCount = static_cast<int>(manager.GetAllMarried().size());
-        float mult = 1.0f;
-        if (spouseCount >= kSpouseCountHigh) {
-            mult = kSpouseMultHigh;
-        } else if (spouseCount >= kSpouseCountMedium) {
-            mult = kSpouseMultMedium;
-        } else if (spouseCount >= kSpouseCountLow) {
-            mult = kSpouseMultLow;
-        }
-
-        if (npcData->status == RelationshipStatus::Engaged) {
-            mult *= kEngagedDecayMultiplier;
-        }
-
-        // Apply user-configured decay multiplier
-        mult *= decayMultiplier_;
-
-        // Calculate final decay (negative value)
-        float decay = -(perDay * mult);
-
-        MARAS_LOG_DEBUG("Loneliness decay for NPC {:08X}: perDay={}, mult={}, decayMult={}, final={}", npcFormID,
-                        perDay, mult / decayMultiplier_, decayMultiplier_, decay);
-
-        return decay;
+    float AffectionService::SpouseCountDecayMultiplier(std::size_t spouseCount) {
+        if (spouseCount >= kSpouseCountHigh) return kSpouseMultHigh;
+        if (spouseCount >= kSpouseCountMedium) return kSpouseMultMedium;
+        if (spouseCount >= kSpouseCountLow) return kSpouseMultLow;
+        return 1.0f;
+    }
+
+    AffectionKernels::DecayParams AffectionService::BuildDecayParams(std::size_t spouseCount) const {
+        static_assert(kDecayByTemperament.size() <= AffectionKernels::DecayParams{}.perDayByTemperament.size());
+
+        AffectionKernels::DecayParams params;
+        params.perDayByTemperament.fill(kDecayDefault);
+        std::copy(kDecayByTemperament.begin(), kDecayByTemperament.end(), params.perDayByTemperament.begin());
+        params.defaultPerDay = kDecayDefault;
+        params.spouseMultiplier = SpouseCountDecayMultiplier(spouseCount);
+        params.engagedMultiplier = kEngagedDecayMultiplier;
+        params.decayMultiplier = decayMultiplier_;
+        params.followingBonus = kFollowingAffectionBonus;
+        params.daysBeforeDecay = kDaysBeforeDecayStarts;
+        return params;
     }
 
 }  // namespace MARAS
@@ -0,0 +1,87 @@
+#include <algorithm>
+
+#include "core/AffectionService.h"
+
+namespace MARAS {
+
+    void AffectionStore::Bind(std::uint32_t slot, RE::FormID npcFormID) {
+        if (slot >= owner_.size()) {
+            const std::size_t rows = std::size_t{slot} + 1;
+            owner_.resize(rows, 0);
+            permanent_.resize(rows, 0);
+            hasPermanent_.resize(rows, 0);
+            published_.resize(rows, 0);
+            dirty_.resize(rows, 0);
+            lastDay_.resize(rows, kNeverRecorded);
+            touched_.resize(rows, 0);
+            daily_.resize(rows * kTypeCount, 0.0f);
+        }
+
+        if (owner_[slot] != npcFormID) {
+            Reset(slot);
+            owner_[slot] = npcFormID;
+        }
+    }
+
+    void AffectionStore::Reset(std::uint32_t row) {
+        if (row >= owner_.size()) return;
+        owner_[row] = 0;
+        permanent_[row] = 0;
+        hasPermanent_[row] = 0;
+        published_[row] = 0;
+        dirty_[row] = 0;
+        lastDay_[row] = kNeverRecorded;
+        ClearDaily(row);
+    }
+
+    void AffectionStore::Clear() {
+        owner_.clear();
+        permanent_.clear();
+        hasPermanent_.clear();
+        published_.clear();
+        dirty_.clear();
+        lastDay_.clear();
+        touched_.clear();
+        daily_.clear();
+        spill_.clear();
+    }
+
+    void AffectionStore::AddDaily(std::uint32_t row, std::size_t typeId, float amount) {
+        if (typeId < kTypeCount) {
+            daily_[std::size_t{row} * kTypeCount + typeId] += amount;
+            touched_[row] |= static_cast<std::uint16_t>(1u << typeId);
+            return;
+        }
+
+        auto& spilled = spill_[row];
+        auto it = std::find_if(spilled.begin(), spilled.end(), [typeId](const auto& e) { return e.first == typeId; });
+        if (it != spilled.end()) {
+            it->second += amount;
+        } else {
+            spilled.emplace_back(static_cast<std::uint16_t>(typeId), amount);
+        }
+    }
+
+    void AffectionStore::ClearDaily(std::uint32_t row) {
+        auto amounts = Daily(row);
+        std::fill(amounts.begin(), amounts.end(), 0.0f);
+        touched_[row] = 0;
+        spill_.erase(row);
+    }
+
+    float AffectionStore::DailyAmount(std::uint32_t row, std::size_t typeId) const {
+        if (typeId < kTypeCount) return Daily(row)[typeId];
+        if (const auto* spilled = Spill(row)) {
+            for (const auto& [id, amount] : *spilled) {
+                if (id == typeId) return amount;
+            }
+        }
+        return 0.0f;
+    }
+
+    const AffectionStore::SpillList* AffectionStore::Spill(std::uint32_t row) const {
+        auto it = spill_.find(row);
+        return it != spill_.end() ? &it->second : nullptr;
+    }
+
+}  // namespace MARAS
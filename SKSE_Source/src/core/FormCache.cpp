@@ -1,7 +1,8 @@
 #include "core/FormCache.h"
 
+#include <chrono>
+
 #include "spdlog/spdlog.h"
-#include "utils/FormUtils.h"
 
 namespace MARAS {
 
@@ -9,26 +10,18 @@ namespace MARAS {
         constexpr const char* PLUGIN_NAME = "TT_MARAS.esp";
         constexpr const char* SKYRIM_ESM = "Skyrim.esm";
 
-        // Helper: Lazy load a form from TT_MARAS.esp with warning
-        template <typename T>
-        T* LazyLoadForm(T*& cache, RE::FormID formID, const char* description) {
-            if (!cache) {
-                cache = Utils::LookupForm<T>(formID, PLUGIN_NAME);
-                if (!cache) {
-                    SPDLOG_WARN("FormCache: failed to load {} ({:#x}) from {}", description, formID, PLUGIN_NAME);
-                }
-            }
-            return cache;
+        // Number of script-added entries of a form list
+        std::size_t AddedFormCount(const RE::BGSListForm* list) {
+            return list->scriptAddedTempForms ? list->scriptAddedTempForms->size() : 0;
         }
 
-        // Helper: Load a form from Skyrim.esm (no caching) with warning
-        template <typename T>
-        T* LoadSkyrimForm(RE::FormID formID, const char* description) {
-            auto form = RE::TESForm::LookupByID<T>(formID);
-            if (!form) {
-                SPDLOG_WARN("FormCache: failed to load {} ({:#x}) from {}", description, formID, SKYRIM_ESM);
+        // Full FormID of a plugin-local FormID, for regular and light plugins
+        RE::FormID ToFullFormID(const RE::TESFile* file, RE::FormID localFormID) {
+            if (file->IsLight()) {
+                return 0xFE000000 | (static_cast<RE::FormID>(file->GetSmallFileCompileIndex()) << 12) |
+                       (localFormID & 0xFFF);
             }
-            return form;
+            return (static_cast<RE::FormID>(file->GetCompileIndex()) << 24) | (localFormID & 0x00FFFFFF);
         }
     }  // namespace
 
@@ -37,239 +30,246 @@ namespace MARAS {
         return instance;
     }
 
-    // TT_MARAS.esp Faction getters
-    RE::TESFaction* FormCache::GetTrackedFaction() { return LazyLoadForm(trackedFaction_, 0x7, "tracked faction"); }
-
-    RE::TESFaction* FormCache::GetSpouseSocialClassFaction() {
-        return LazyLoadForm(spouseSocialClassFaction_, 0x66, "spouse social class faction");
-    }
-
-    RE::TESFaction* FormCache::GetSpouseSkillTypeFaction() {
-        return LazyLoadForm(spouseSkillTypeFaction_, 0x4e, "spouse skill type faction");
-    }
-
-    RE::TESFaction* FormCache::GetSpouseTemperamentFaction() {
-        return LazyLoadForm(spouseTemperamentFaction_, 0x118, "spouse temperament faction");
-    }
-
-    RE::TESFaction* FormCache::GetSpouseHousedFaction() {
-        return LazyLoadForm(spouseHousedFaction_, 0x6c, "spouse housed faction");
-    }
-
-    RE::TESFaction* FormCache::GetHierarchyFaction() {
-        return LazyLoadForm(hierarchyFaction_, 0x111, "hierarchy faction");
-    }
-
-    RE::TESFaction* FormCache::GetAffectionFaction() {
-        return LazyLoadForm(affectionFaction_, 0x119, "affection faction");
-    }
-
-    RE::BGSKeyword* FormCache::GetIgnoreProposeKeyword() {
-        return LazyLoadForm(ignoreProposeKeyword_, 0xC0B, "TTM ignore propose keyword");
-    }
-
-    RE::BGSKeyword* FormCache::GetHomeSandboxKeyword() {
-        return LazyLoadForm(homeSandboxKeyword_, 0x6B, "home sandbox keyword");
-    }
-
-    RE::TESObjectSTAT* FormCache::GetHomeSandboxMarkerStatic() {
-        return LazyLoadForm(homeSandboxMarkerStatic_, 0x76, "home sandbox marker static");
-    }
-
-    RE::TESPackage* FormCache::GetHomeSandboxPackage() {
-        return LazyLoadForm(homeSandboxPackage_, 0x6a, "home sandbox package");
-    }
-
-    // MARAS housed spouses merchant factions
-    RE::TESFaction* FormCache::GetApothecaryMerchantHousedFaction() {
-        return LazyLoadForm(apothecaryHouseMerchantFaction_, 0xc0c, "apothecary housed merchant faction");
-    }
-    RE::TESFaction* FormCache::GetBlacksmithMerchantHousedFaction() {
-        return LazyLoadForm(blacksmithHouseMerchantFaction_, 0xc0d, "blacksmith housed merchant faction");
-    }
-    RE::TESFaction* FormCache::GetFletcherMerchantHousedFaction() {
-        return LazyLoadForm(fletcherHouseMerchantFaction_, 0xc12, "fletcher housed merchant faction");
-    }
-    RE::TESFaction* FormCache::GetHunterMerchantHousedFaction() {
-        return LazyLoadForm(hunterHouseMerchantFaction_, 0xc14, "hunter housed merchant faction");
-    }
-    RE::TESFaction* FormCache::GetInnkeeperMerchantHousedFaction() {
-        return LazyLoadForm(innkeeperHouseMerchantFaction_, 0xc0e, "innkeeper housed merchant faction");
-    }
-    RE::TESFaction* FormCache::GetJewelerMerchantHousedFaction() {
-        return LazyLoadForm(jewelerHouseMerchantFaction_, 0xc13, "jeweler housed merchant faction");
-    }
-    RE::TESFaction* FormCache::GetMiscMerchantHousedFaction() {
-        return LazyLoadForm(miscHouseMerchantFaction_, 0xc0f, "misc housed merchant faction");
-    }
-    RE::TESFaction* FormCache::GetSpellsMerchantHousedFaction() {
-        return LazyLoadForm(spellsHouseMerchantFaction_, 0xc10, "spells housed merchant faction");
-    }
-    RE::TESFaction* FormCache::GetTailorMerchantHousedFaction() {
-        return LazyLoadForm(tailorHouseMerchantFaction_, 0xc11, "tailor housed merchant faction");
-    }
-
-
-    RE::TESFaction* FormCache::GetMerchantFaction() { return LoadSkyrimForm<RE::TESFaction>(0x51596, "Merchant faction"); }
-
-    // Skyrim merchant factions
-    RE::TESFaction* FormCache::GetApothecaryFaction() { return LoadSkyrimForm<RE::TESFaction>(0x5091c, "Apothecary merchant faction"); }
-    RE::TESFaction* FormCache::GetBlacksmithFaction() { return LoadSkyrimForm<RE::TESFaction>(0x5091d, "Blacksmith merchant faction"); }
-    RE::TESFaction* FormCache::GetFletcherFaction() { return LoadSkyrimForm<RE::TESFaction>(0x51592, "Fletcher merchant faction"); }
-    RE::TESFaction* FormCache::GetInnKeeperFaction() { return LoadSkyrimForm<RE::TESFaction>(0x5091b, "InnKeeper merchant faction"); }
-    RE::TESFaction* FormCache::GetJewelerFaction() { return LoadSkyrimForm<RE::TESFaction>(0x806a9, "Jeweler merchant faction"); }
-    RE::TESFaction* FormCache::GetMiscFaction() { return LoadSkyrimForm<RE::TESFaction>(0x51599, "Misc merchant faction"); }
-    RE::TESFaction* FormCache::GetSpellFaction() { return LoadSkyrimForm<RE::TESFaction>(0x50921, "Spell merchant faction"); }
-    RE::TESFaction* FormCache::GetTailorFaction() { return LoadSkyrimForm<RE::TESFaction>(0xa6c00, "Tailor merchant faction"); } // radiant raiments shop
-    RE::TESFaction* FormCache::GetHunterFaction() { return LoadSkyrimForm<RE::TESFaction>(0xac9c2, "Hunter merchant faction"); }
-
-    // Marriage-related faction getters (from Skyrim.esm)
-    RE::TESFaction* FormCache::GetMarriagePotentialFaction() {
-        return LoadSkyrimForm<RE::TESFaction>(0x19809, "marriage potential faction");
-    }
-
-    RE::TESFaction* FormCache::GetMarriageAskedFaction() {
-        return LoadSkyrimForm<RE::TESFaction>(0xff7f3, "marriage asked faction");
-    }
-
-    RE::TESFaction* FormCache::GetCourtingFaction() {
-        return LoadSkyrimForm<RE::TESFaction>(0x7431a, "courting faction");
-    }
-
-    RE::TESFaction* FormCache::GetPotentialHirelingFaction() {
-        return LoadSkyrimForm<RE::TESFaction>(0xbcc9a, "potential hireling faction");
-    }
-
-    RE::TESFaction* FormCache::GetMarriedFaction() {
-        return LoadSkyrimForm<RE::TESFaction>(0xc6472, "married faction");
-    }
-
-    RE::TESFaction* FormCache::GetPlayerBedOwnershipFaction() {
-        return LoadSkyrimForm<RE::TESFaction>(0xf2073, "player bed ownership faction");
-    }
-
-    // TT_MARAS.esp FormList getters (Social Classes)
-    RE::BGSListForm* FormCache::GetRulerFactions() { return LazyLoadForm(rulerFactions_, 0xd75, "ruler factions"); }
-
-    RE::BGSListForm* FormCache::GetNobleFactions() { return LazyLoadForm(nobleFactions_, 0xd76, "noble factions"); }
-
-    RE::BGSListForm* FormCache::GetReligiousFactions() {
-        return LazyLoadForm(religiousFactions_, 0xd77, "religious factions");
-    }
-
-    RE::BGSListForm* FormCache::GetWealthyFactions() {
-        return LazyLoadForm(wealthyFactions_, 0xd71, "wealthy factions");
-    }
-
-    RE::BGSListForm* FormCache::GetMiddleFactions() { return LazyLoadForm(middleFactions_, 0x4, "middle factions"); }
-
-    RE::BGSListForm* FormCache::GetPovertyFactions() {
-        return LazyLoadForm(povertyFactions_, 0xd74, "poverty factions");
-    }
-
-    RE::BGSListForm* FormCache::GetOutcastFactions() {
-        return LazyLoadForm(outcastFactions_, 0xd70, "outcast factions");
-    }
-
-    // TT_MARAS.esp FormList getters (Skill Classes)
-    RE::BGSListForm* FormCache::GetOratorClasses() { return LazyLoadForm(oratorClasses_, 0x13, "orator classes"); }
-
-    RE::BGSListForm* FormCache::GetRangerClasses() { return LazyLoadForm(rangerClasses_, 0x10, "ranger classes"); }
-
-    RE::BGSListForm* FormCache::GetRogueClasses() { return LazyLoadForm(rogueClasses_, 0x11, "rogue classes"); }
-
-    RE::BGSListForm* FormCache::GetCraftsmanClasses() {
-        return LazyLoadForm(craftsmanClasses_, 0x12, "craftsman classes");
-    }
-
-    RE::BGSListForm* FormCache::GetMageClasses() { return LazyLoadForm(mageClasses_, 0xf, "mage classes"); }
-
-    RE::BGSListForm* FormCache::GetWarriorClasses() { return LazyLoadForm(warriorClasses_, 0xe, "warrior classes"); }
-
-    // TT_MARAS.esp Globals
-    RE::TESGlobal* FormCache::GetLoveInterestsCount() {
-        return LazyLoadForm(loveInterestsCount_, 0x4f, "LoveInterestsCount global");
-    }
-
-    RE::TESGlobal* FormCache::GetSpousesCount() { return LazyLoadForm(spousesCount_, 0x117, "SpousesCount global"); }
-    RE::TESGlobal* FormCache::GetPlayerHousesCount() {
-        return LazyLoadForm(playerHousesCount_, 0xc2, "PlayerHousesCount global");
-    }
-
-    // Skyrim.esm Faction getters (not cached)
-    RE::TESFaction* FormCache::GetPlayerFaction() { return LoadSkyrimForm<RE::TESFaction>(0xDB1, "player faction"); }
-
-    RE::TESFaction* FormCache::GetCompanionsFaction() {
-        return LoadSkyrimForm<RE::TESFaction>(0x48362, "Companions faction");
-    }
-
-    RE::TESFaction* FormCache::GetThievesFaction() {
-        return LoadSkyrimForm<RE::TESFaction>(0x29da9, "Thieves faction");
-    }
-
-    RE::TESFaction* FormCache::GetBrotherhoodFaction() {
-        return LoadSkyrimForm<RE::TESFaction>(0x1bdb3, "Dark Brotherhood faction");
-    }
-
-    RE::TESFaction* FormCache::GetCollegeFaction() {
-        return LoadSkyrimForm<RE::TESFaction>(0x1f259, "College faction");
-    }
+    void FormCache::WarmUp() {
+        enum class Source : std::uint8_t { Maras, Skyrim };
+        struct ManifestEntry {
+            Slot slot;
+            Source source;
+            RE::FormID formID;  // plugin-local for TT_MARAS.esp, full for Skyrim.esm
+            RE::FormType type;
+            const char* description;
+        };
+
+        // Every form the plugin uses, one entry per Slot
+        static constexpr ManifestEntry kManifest[] = {
+            {Slot::TrackedFaction, Source::Maras, 0x7, RE::FormType::Faction, "tracked faction"},
+            {Slot::SpouseSocialClassFaction, Source::Maras, 0x66, RE::FormType::Faction, "spouse social class faction"},
+            {Slot::SpouseSkillTypeFaction, Source::Maras, 0x4e, RE::FormType::Faction, "spouse skill type faction"},
+            {Slot::SpouseTemperamentFaction, Source::Maras, 0x118, RE::FormType::Faction, "spouse temperament faction"},
+            {Slot::SpouseHousedFaction, Source::Maras, 0x6c, RE::FormType::Faction, "spouse housed faction"},
+            {Slot::HierarchyFaction, Source::Maras, 0x111, RE::FormType::Faction, "hierarchy faction"},
+            {Slot::AffectionFaction, Source::Maras, 0x119, RE::FormType::Faction, "affection faction"},
+            {Slot::MarriagePotentialFaction, Source::Skyrim, 0x19809, RE::FormType::Faction,
+             "marriage potential faction"},
+            {Slot::MarriageAskedFaction, Source::Skyrim, 0xff7f3, RE::FormType::Faction, "marriage asked faction"},
+            {Slot::CourtingFaction, Source::Skyrim, 0x7431a, RE::FormType::Faction, "courting faction"},
+            {Slot::PotentialHirelingFaction, Source::Skyrim, 0xbcc9a, RE::FormType::Faction,
+             "potential hireling faction"},
+            {Slot::MarriedFaction, Source::Skyrim, 0xc6472, RE::FormType::Faction, "married faction"},
+            {Slot::PlayerBedOwnershipFaction, Source::Skyrim, 0xf2073, RE::FormType::Faction,
+             "player bed ownership faction"},
+            {Slot::RulerFactions, Source::Maras, 0xd75, RE::FormType::FormList, "ruler factions"},
+            {Slot::NobleFactions, Source::Maras, 0xd76, RE::FormType::FormList, "noble factions"},
+            {Slot::ReligiousFactions, Source::Maras, 0xd77, RE::FormType::FormList, "religious factions"},
+            {Slot::WealthyFactions, Source::Maras, 0xd71, RE::FormType::FormList, "wealthy factions"},
+            {Slot::MiddleFactions, Source::Maras, 0x4, RE::FormType::FormList, "middle factions"},
+            {Slot::PovertyFactions, Source::Maras, 0xd74, RE::FormType::FormList, "poverty factions"},
+            {Slot::OutcastFactions, Source::Maras, 0xd70, RE::FormType::FormList, "outcast factions"},
+            {Slot::OratorClasses, Source::Maras, 0x13, RE::FormType::FormList, "orator classes"},
+            {Slot::RangerClasses, Source::Maras, 0x10, RE::FormType::FormList, "ranger classes"},
+            {Slot::RogueClasses, Source::Maras, 0x11, RE::FormType::FormList, "rogue classes"},
+            {Slot::CraftsmanClasses, Source::Maras, 0x12, RE::FormType::FormList, "craftsman classes"},
+            {Slot::MageClasses, Source::Maras, 0xf, RE::FormType::FormList, "mage classes"},
+            {Slot::WarriorClasses, Source::Maras, 0xe, RE::FormType::FormList, "warrior classes"},
+            {Slot::IgnoreProposeKeyword, Source::Maras, 0xC0B, RE::FormType::Keyword, "TTM ignore propose keyword"},
+            {Slot::PlayerFaction, Source::Skyrim, 0xDB1, RE::FormType::Faction, "player faction"},
+            {Slot::CompanionsFaction, Source::Skyrim, 0x48362, RE::FormType::Faction, "Companions faction"},
+            {Slot::ThievesFaction, Source::Skyrim, 0x29da9, RE::FormType::Faction, "Thieves faction"},
+            {Slot::BrotherhoodFaction, Source::Skyrim, 0x1bdb3, RE::FormType::Faction, "Dark Brotherhood faction"},
+            {Slot::CollegeFaction, Source::Skyrim, 0x1f259, RE::FormType::Faction, "College faction"},
+            {Slot::BardsFaction, Source::Skyrim, 0xc13c7, RE::FormType::Faction, "Bards faction"},
+            {Slot::MerchantFaction, Source::Skyrim, 0x51596, RE::FormType::Faction, "Merchant faction"},
+            {Slot::ApothecaryFaction, Source::Skyrim, 0x5091c, RE::FormType::Faction, "Apothecary merchant faction"},
+            {Slot::BlacksmithFaction, Source::Skyrim, 0x5091d, RE::FormType::Faction, "Blacksmith merchant faction"},
+            {Slot::FletcherFaction, Source::Skyrim, 0x51592, RE::FormType::Faction, "Fletcher merchant faction"},
+            {Slot::InnKeeperFaction, Source::Skyrim, 0x5091b, RE::FormType::Faction, "InnKeeper merchant faction"},
+            {Slot::JewelerFaction, Source::Skyrim, 0x806a9, RE::FormType::Faction, "Jeweler merchant faction"},
+            {Slot::MiscFaction, Source::Skyrim, 0x51599, RE::FormType::Faction, "Misc merchant faction"},
+            {Slot::SpellFaction, Source::Skyrim, 0x50921, RE::FormType::Faction, "Spell merchant faction"},
+            {Slot::TailorFaction, Source::Skyrim, 0xa6c00, RE::FormType::Faction, "Tailor merchant faction"},
+            {Slot::HunterFaction, Source::Skyrim, 0xac9c2, RE::FormType::Faction, "Hunter merchant faction"},
+            {Slot::ApothecaryMerchantHousedFaction, Source::Maras, 0xc0c, RE::FormType::Faction,
+             "apothecary housed merchant faction"},
+            {Slot::BlacksmithMerchantHousedFaction, Source::Maras, 0xc0d, RE::FormType::Faction,
+             "blacksmith housed merchant faction"},
+            {Slot::FletcherMerchantHousedFaction, Source::Maras, 0xc12, RE::FormType::Faction,
+             "fletcher housed merchant faction"},
+            {Slot::HunterMerchantHousedFaction, Source::Maras, 0xc14, RE::FormType::Faction,
+             "hunter housed merchant faction"},
+            {Slot::InnkeeperMerchantHousedFaction, Source::Maras, 0xc0e, RE::FormType::Faction,
+             "innkeeper housed merchant faction"},
+            {Slot::JewelerMerchantHousedFaction, Source::Maras, 0xc13, RE::FormType::Faction,
+             "jeweler housed merchant faction"},
+            {Slot::MiscMerchantHousedFaction, Source::Maras, 0xc0f, RE::FormType::Faction,
+             "misc housed merchant faction"},
+            {Slot::SpellsMerchantHousedFaction, Source::Maras, 0xc10, RE::FormType::Faction,
+             "spells housed merchant faction"},
+            {Slot::TailorMerchantHousedFaction, Source::Maras, 0xc11, RE::FormType::Faction,
+             "tailor housed merchant faction"},
+            {Slot::EastmarchThane, Source::Skyrim, 0xa2ca6, RE::FormType::Quest, "Eastmarch Thane quest"},
+            {Slot::FalkreathThane, Source::Skyrim, 0xa34de, RE::FormType::Quest, "Falkreath Thane quest"},
+            {Slot::HaafingarThane, Source::Skyrim, 0xa2c9b, RE::FormType::Quest, "Haafingar Thane quest"},
+            {Slot::HjaalmarchThane, Source::Skyrim, 0xa34ce, RE::FormType::Quest, "Hjaalmarch Thane quest"},
+            {Slot::PaleThane, Source::Skyrim, 0xa34d4, RE::FormType::Quest, "Pale Thane quest"},
+            {Slot::ReachThane, Source::Skyrim, 0xa2c86, RE::FormType::Quest, "Reach Thane quest"},
+            {Slot::RiftThane, Source::Skyrim, 0x65bdf, RE::FormType::Quest, "Rift Thane quest"},
+            {Slot::WhiterunThane, Source::Skyrim, 0xa2c9e, RE::FormType::Quest, "Whiterun Thane quest"},
+            {Slot::WinterholdThane, Source::Skyrim, 0xa34d7, RE::FormType::Quest, "Winterhold Thane quest"},
+            {Slot::CompanionsQuest, Source::Skyrim, 0x1cef6, RE::FormType::Quest, "Companions guild leader quest"},
+            {Slot::CollegeQuest, Source::Skyrim, 0x1f258, RE::FormType::Quest, "College guild leader quest"},
+            {Slot::ThievesQuest, Source::Skyrim, 0xd7d69, RE::FormType::Quest, "Thieves guild leader quest"},
+            {Slot::BardsQuest, Source::Skyrim, 0x53511, RE::FormType::Quest, "become bards quest"},
+            {Slot::DragonbornQuest, Source::Skyrim, 0x2610c, RE::FormType::Quest, "become dragonborn quest"},
+            {Slot::LoveInterestsCount, Source::Maras, 0x4f, RE::FormType::Global, "LoveInterestsCount global"},
+            {Slot::SpousesCount, Source::Maras, 0x117, RE::FormType::Global, "SpousesCount global"},
+            {Slot::PlayerHousesCount, Source::Maras, 0xc2, RE::FormType::Global, "PlayerHousesCount global"},
+            {Slot::ClothingRichKeyword, Source::Skyrim, 0xA865D, RE::FormType::Keyword, "clothing rich keyword"},
+            {Slot::HomeSandboxKeyword, Source::Maras, 0x6B, RE::FormType::Keyword, "home sandbox keyword"},
+            {Slot::HomeSandboxMarkerStatic, Source::Maras, 0x76, RE::FormType::Static, "home sandbox marker static"},
+            {Slot::HomeSandboxPackage, Source::Maras, 0x6a, RE::FormType::Package, "home sandbox package"},
+        };
+
+        static_assert(std::size(kManifest) == kSlotCount, "Every FormCache slot needs exactly one manifest entry");
+        static_assert(
+            [] {
+                for (std::size_t i = 0; i < std::size(kManifest); ++i) {
+                    if (static_cast<std::size_t>(kManifest[i].slot) != i) return false;
+                }
+                return true;
+            }(),
+            "FormCache manifest entries must be in Slot order");
 
-    RE::TESFaction* FormCache::GetBardsFaction() { return LoadSkyrimForm<RE::TESFaction>(0xc13c7, "Bards faction"); }
+        const auto start = std::chrono::steady_clock::now();
 
-    // Skyrim.esm Quest getters (Thane quests)
-    RE::TESQuest* FormCache::GetEastmarchThane() {
-        return LoadSkyrimForm<RE::TESQuest>(0xa2ca6, "Eastmarch Thane quest");
-    }
+        // The plugin is looked up once; every TT_MARAS.esp form is then resolved from its compile index
+        const RE::TESFile* marasFile = nullptr;
+        if (auto* dataHandler = RE::TESDataHandler::GetSingleton()) {
+            marasFile = dataHandler->LookupModByName(PLUGIN_NAME);
+        }
+        if (!marasFile) {
+            SPDLOG_ERROR("FormCache: {} is not loaded; its forms are unavailable", PLUGIN_NAME);
+        }
 
-    RE::TESQuest* FormCache::GetFalkreathThane() {
-        return LoadSkyrimForm<RE::TESQuest>(0xa34de, "Falkreath Thane quest");
-    }
+        std::size_t resolved = 0;
+        for (const auto& entry : kManifest) {
+            const bool fromMaras = entry.source == Source::Maras;
+            RE::TESForm* form = nullptr;
+            if (!fromMaras) {
+                form = RE::TESForm::LookupByID(entry.formID);
+            } else if (marasFile) {
+                form = RE::TESForm::LookupByID(ToFullFormID(marasFile, entry.formID));
+            }
+            if (form && form->GetFormType() != entry.type) {
+                SPDLOG_WARN("FormCache: {} ({:#x}) in {} has an unexpected form type", entry.description,
+                            entry.formID, fromMaras ? PLUGIN_NAME : SKYRIM_ESM);
+                form = nullptr;
+            }
 
-    RE::TESQuest* FormCache::GetHaafingarThane() {
-        return LoadSkyrimForm<RE::TESQuest>(0xa2c9b, "Haafingar Thane quest");
-    }
+            forms_[static_cast<std::size_t>(entry.slot)] = form;
+            if (form) {
+                ++resolved;
+            } else if (!fromMaras || marasFile) {
+                SPDLOG_WARN("FormCache: failed to load {} ({:#x}) from {}", entry.description, entry.formID,
+                            fromMaras ? PLUGIN_NAME : SKYRIM_ESM);
+            }
+        }
 
-    RE::TESQuest* FormCache::GetHjaalmarchThane() {
-        return LoadSkyrimForm<RE::TESQuest>(0xa34ce, "Hjaalmarch Thane quest");
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        SPDLOG_INFO("FormCache: resolved {}/{} forms in {} us", resolved, kSlotCount, elapsed.count());
+    }
+
+    // Membership lookups
+    RE::BGSListForm* FormCache::GetList(ListId id) const {
+        switch (id) {
+            case ListId::RulerFactions:
+                return GetRulerFactions();
+            case ListId::NobleFactions:
+                return GetNobleFactions();
+            case ListId::ReligiousFactions:
+                return GetReligiousFactions();
+            case ListId::WealthyFactions:
+                return GetWealthyFactions();
+            case ListId::MiddleFactions:
+                return GetMiddleFactions();
+            case ListId::PovertyFactions:
+                return GetPovertyFactions();
+            case ListId::OutcastFactions:
+                return GetOutcastFactions();
+            case ListId::OratorClasses:
+                return GetOratorClasses();
+            case ListId::RangerClasses:
+                return GetRangerClasses();
+            case ListId::RogueClasses:
+                return GetRogueClasses();
+            case ListId::CraftsmanClasses:
+                return GetCraftsmanClasses();
+            case ListId::MageClasses:
+                return GetMageClasses();
+            case ListId::WarriorClasses:
+                return GetWarriorClasses();
+            default:
+                return nullptr;
+        }
     }
 
-    RE::TESQuest* FormCache::GetPaleThane() { return LoadSkyrimForm<RE::TESQuest>(0xa34d4, "Pale Thane quest"); }
+    bool FormCache::ContainsFast(ListId id, RE::FormID formID) {
+        const auto index = static_cast<std::size_t>(id);
+        if (index >= listMembership_.size()) return false;
 
-    RE::TESQuest* FormCache::GetReachThane() { return LoadSkyrimForm<RE::TESQuest>(0xa2c86, "Reach Thane quest"); }
+        auto* list = GetList(id);
+        if (!list) return false;
 
-    RE::TESQuest* FormCache::GetRiftThane() { return LoadSkyrimForm<RE::TESQuest>(0x65bdf, "Rift Thane quest"); }
-
-    RE::TESQuest* FormCache::GetWhiterunThane() {
-        return LoadSkyrimForm<RE::TESQuest>(0xa2c9e, "Whiterun Thane quest");
-    }
-
-    RE::TESQuest* FormCache::GetWinterholdThane() {
-        return LoadSkyrimForm<RE::TESQuest>(0xa34d7, "Winterhold Thane quest");
-    }
-
-    // Skyrim.esm Quest getters (Guild/Achievement quests)
-    RE::TESQuest* FormCache::GetCompanionsQuest() {
-        return LoadSkyrimForm<RE::TESQuest>(0x1cef6, "Companions guild leader quest");
+        auto& membership = listMembership_[index];
+        const auto* set = membership.current.load(std::memory_order_acquire);
+        if (set && set->formCount == list->forms.size() && set->addedCount == AddedFormCount(list)) {
+            if (set->forms.contains(formID)) return true;
+            // A miss may come from a script edit that kept the counts; only then pay for the full stamp
+            if (set->stamp == ListStamp(list)) return false;
+        }
+        return RebuildMembership(list, membership)->forms.contains(formID);
     }
 
-    RE::TESQuest* FormCache::GetCollegeQuest() {
-        return LoadSkyrimForm<RE::TESQuest>(0x1f258, "College guild leader quest");
-    }
+    const FormCache::MembershipSet* FormCache::RebuildMembership(const RE::BGSListForm* list,
+                                                                 ListMembership& membership) {
+        std::lock_guard lock(membership.rebuildMutex);
 
-    RE::TESQuest* FormCache::GetThievesQuest() {
-        return LoadSkyrimForm<RE::TESQuest>(0xd7d69, "Thieves guild leader quest");
-    }
+        // Another thread may have rebuilt it while this one waited
+        const auto stamp = ListStamp(list);
+        const auto formCount = list->forms.size();
+        const auto addedCount = AddedFormCount(list);
+        if (const auto* current = membership.current.load(std::memory_order_acquire);
+            current && current->stamp == stamp && current->formCount == formCount &&
+            current->addedCount == addedCount) {
+            return current;
+        }
 
-    RE::TESQuest* FormCache::GetBardsQuest() { return LoadSkyrimForm<RE::TESQuest>(0x53511, "become bards quest"); }
+        auto set = std::make_unique<MembershipSet>();
+        set->stamp = stamp;
+        set->formCount = formCount;
+        set->addedCount = addedCount;
+        for (auto* form : list->forms) {
+            if (form) set->forms.insert(form->GetFormID());
+        }
+        if (list->scriptAddedTempForms) {
+            for (auto addedID : *list->scriptAddedTempForms) set->forms.insert(addedID);
+        }
+        SPDLOG_DEBUG("FormCache: built membership set for list {:#x} ({} forms)", list->GetFormID(),
+                     set->forms.size());
 
-    RE::TESQuest* FormCache::GetDragonbornQuest() {
-        return LoadSkyrimForm<RE::TESQuest>(0x2610c, "become dragonborn quest");
+        const auto* published = set.get();
+        membership.built.push_back(std::move(set));
+        membership.current.store(published, std::memory_order_release);
+        return published;
     }
 
-    // Skyrim.esm Keyword getters
-    RE::BGSKeyword* FormCache::GetClothingRichKeyword() {
-        return LoadSkyrimForm<RE::BGSKeyword>(0xA865D, "clothing rich keyword");
+    std::uint64_t FormCache::ListStamp(const RE::BGSListForm* list) {
+        if (!list) return 0;
+        std::uint64_t stamp = list->forms.size() + 1;
+        if (list->scriptAddedTempForms) {
+            for (auto formID : *list->scriptAddedTempForms) stamp = stamp * 31 + formID;
+        }
+        return stamp;
     }
 
 }  // namespace MARAS
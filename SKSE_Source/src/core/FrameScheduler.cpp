@@ -0,0 +1,165 @@
+#include "core/FrameScheduler.h"
+
+#include <algorithm>
+
+#include "utils/Common.h"
+
+namespace MARAS {
+
+    // ─── Per-frame hook ───────────────────────────────────────────────────────────
+
+    struct FrameScheduler::PlayerUpdateHook {
+        static void thunk(RE::PlayerCharacter* player, float delta) {
+            func(player, delta);
+            FrameScheduler::GetSingleton().Tick();
+        }
+
+        static inline REL::Relocation<decltype(thunk)> func;
+        static constexpr std::size_t kIndex = 0xAD;  // Actor::Update
+
+        static void Install() {
+            REL::Relocation<std::uintptr_t> vtbl{RE::VTABLE_PlayerCharacter[0]};
+            func = vtbl.write_vfunc(kIndex, thunk);
+            MARAS_LOG_INFO("FrameScheduler: PlayerCharacter::Update hook installed");
+        }
+    };
+
+    void FrameScheduler::InstallHooks() { PlayerUpdateHook::Install(); }
+
+    // ─── Scheduling ───────────────────────────────────────────────────────────────
+
+    FrameScheduler& FrameScheduler::GetSingleton() {
+        static FrameScheduler instance;
+        return instance;
+    }
+
+    FrameScheduler::FrameScheduler() : origin_(Clock::now()), rng_(std::random_device{}()) {}
+
+    std::uint64_t FrameScheduler::CurrentTick(Clock::time_point now) const {
+        return static_cast<std::uint64_t>((now - origin_) / kTickResolution);
+    }
+
+    void FrameScheduler::Arm(std::uint32_t index, std::uint64_t fromTick, bool firstRun) {
+        auto& entry = jobs_[index];
+
+        auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(entry.interval);
+        if (entry.jitter.count() > 0) {
+            const auto spread = entry.jitter.count();
+            std::uniform_int_distribution<long long> dist(firstRun ? 0 : -spread, spread);
+            delay += std::chrono::milliseconds{dist(rng_)};
+        }
+
+        // Always at least one tick out, so a rescheduled job never lands in the slot being drained
+        const auto ticks = std::max<std::int64_t>(1, delay / kTickResolution);
+        entry.dueTick = fromTick + static_cast<std::uint64_t>(ticks);
+        wheel_[entry.dueTick % kWheelSize].push_back(index);
+    }
+
+    void FrameScheduler::Schedule(std::string name, std::chrono::milliseconds interval, Job job,
+                                  std::chrono::milliseconds jitter) {
+        if (!job) return;
+
+        // Replacing a job retires the old entry; its wheel/ready reference is dropped (and the entry reclaimed) when
+        // next visited
+        Cancel(name);
+
+        Entry entry{name, std::max(interval, kTickResolution), jitter, std::move(job), 0, true};
+        std::uint32_t index;
+        if (!freeJobs_.empty()) {
+            index = freeJobs_.back();
+            freeJobs_.pop_back();
+            jobs_[index] = std::move(entry);
+        } else {
+            jobs_.push_back(std::move(entry));
+            index = static_cast<std::uint32_t>(jobs_.size() - 1);
+        }
+        jobsByName_.emplace(std::move(name), index);
+        Arm(index, CurrentTick(Clock::now()), true);
+
+        MARAS_LOG_DEBUG("FrameScheduler: scheduled '{}' every {} ms (jitter {} ms)", jobs_[index].name,
+                        jobs_[index].interval.count(), jobs_[index].jitter.count());
+    }
+
+    bool FrameScheduler::Cancel(std::string_view name) {
+        auto it = jobsByName_.find(name);
+        if (it == jobsByName_.end()) return false;
+
+        // Keep the callable alive: a job may cancel itself while it is running
+        jobs_[it->second].active = false;
+        jobsByName_.erase(it);
+        return true;
+    }
+
+    void FrameScheduler::Reclaim(std::uint32_t index) {
+        auto& entry = jobs_[index];
+        entry.job = nullptr;
+        entry.name.clear();
+        freeJobs_.push_back(index);
+    }
+
+    void FrameScheduler::Tick() {
+        const auto frameStart = Clock::now();
+        const auto nowTick = CurrentTick(frameStart);
+
+        // Visit every slot that elapsed since the last frame; after a long hitch one full lap covers all slots
+        if (nowTick > lastTick_) {
+            const auto first = (nowTick - lastTick_ > kWheelSize) ? nowTick - kWheelSize + 1 : lastTick_ + 1;
+            for (auto tick = first; tick <= nowTick; ++tick) {
+                auto& slot = wheel_[tick % kWheelSize];
+                for (std::size_t i = 0; i < slot.size();) {
+                    const auto index = slot[i];
+                    const auto& entry = jobs_[index];
+                    if (!entry.active || entry.dueTick <= nowTick) {
+                        if (entry.active) {
+                            ready_.push_back(index);
+                        } else {
+                            Reclaim(index);
+                        }
+                        slot[i] = slot.back();
+                        slot.pop_back();
+                    } else {
+                        ++i;  // due on a later lap
+                    }
+                }
+            }
+            lastTick_ = nowTick;
+        }
+
+        // Run due jobs until the budget is spent; whatever is left runs first next frame
+        const auto deadline = frameStart + frameBudget_;
+        while (!ready_.empty()) {
+            const auto index = ready_.front();
+            ready_.pop_front();
+
+            auto& entry = jobs_[index];
+            if (!entry.active) {
+                Reclaim(index);
+                continue;
+            }
+
+            const auto jobStart = Clock::now();
+            try {
+                entry.job();
+            } catch (const std::exception& e) {
+                MARAS_LOG_ERROR("FrameScheduler: job '{}' threw: {}", entry.name, e.what());
+            }
+            const auto jobEnd = Clock::now();
+
+            const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(jobEnd - jobStart);
+            if (elapsed > frameBudget_) {
+                MARAS_LOG_DEBUG("FrameScheduler: job '{}' took {} us (budget {} us)", entry.name, elapsed.count(),
+                                frameBudget_.count());
+            }
+
+            // The job may have cancelled or replaced itself
+            if (entry.active) {
+                Arm(index, nowTick, false);
+            } else {
+                Reclaim(index);
+            }
+
+            if (jobEnd >= deadline) break;
+        }
+    }
+
+}  // namespace MARAS
@@ -2,8 +2,15 @@
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 #include <sstream>
+#include <system_error>
+#include <thread>
 
 #include "core/FormCache.h"
 #include "utils/FormUtils.h"
@@ -18,16 +25,62 @@ namespace MARAS {
         constexpr std::uint32_t FURNITURE_CAN_SLEEP_MASK =
             static_cast<std::uint32_t>(RE::TESFurniture::ActiveMarker::kCanSleep);
 
+        // Cells per work item when scanning in parallel, and the minimum candidate count worth threading
+        constexpr std::size_t kScanChunkSize = 32;
+        constexpr std::size_t kParallelScanThreshold = 128;
+
+        // On-disk index cache. Bump kIndexCacheVersion whenever the layout or the scan rules change so that
+        // caches written by older builds are rebuilt.
+        constexpr const char* kIndexCachePath = "Data/SKSE/Plugins/MARAS/homeCellIndex.bin";
+        constexpr std::uint32_t kIndexCacheMagic = 0x4943484D;  // "MHCI"
+        constexpr std::uint32_t kIndexCacheVersion = 2;
+
+        // 64-bit FNV-1a
+        constexpr std::uint64_t kFnvOffsetBasis = 0xCBF29CE484222325ull;
+        constexpr std::uint64_t kFnvPrime = 0x00000100000001B3ull;
+
+        void HashBytes(std::uint64_t& hash, const void* data, std::size_t size) {
+            auto* bytes = static_cast<const unsigned char*>(data);
+            for (std::size_t i = 0; i < size; ++i) {
+                hash ^= bytes[i];
+                hash *= kFnvPrime;
+            }
+        }
+
+        template <class T>
+        void HashValue(std::uint64_t& hash, const T& value) {
+            HashBytes(hash, &value, sizeof(value));
+        }
+
+        template <class T>
+        void AppendValue(std::vector<char>& buffer, const T& value) {
+            const auto* bytes = reinterpret_cast<const char*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+        }
+
+        // Bounds-checked cursor over the cache file contents
+        struct CacheReader {
+            const char* cur;
+            const char* end;
+
+            template <class T>
+            bool Read(T& value) {
+                if (static_cast<std::size_t>(end - cur) < sizeof(value)) return false;
+                std::memcpy(&value, cur, sizeof(value));
+                cur += sizeof(value);
+                return true;
+            }
+
+            std::size_t Remaining() const { return static_cast<std::size_t>(end - cur); }
+        };
+
         // Helper: Lookup a keyword by FormID
         RE::BGSKeyword* LookupKeyword(RE::FormID formID) { return RE::TESForm::LookupByID<RE::BGSKeyword>(formID); }
 
         // Helper: Check if location has dwelling/house keywords
-        bool IsHomeLocation(RE::BGSLocation* location) {
+        bool IsHomeLocation(RE::BGSLocation* location, RE::BGSKeyword* kwDwelling, RE::BGSKeyword* kwHouse) {
             if (!location) return false;
 
-            auto kwDwelling = LookupKeyword(KEYWORD_DWELLING);
-            auto kwHouse = LookupKeyword(KEYWORD_HOUSE);
-
             if (kwDwelling && location->HasKeyword(kwDwelling)) return true;
             if (kwHouse && location->HasKeyword(kwHouse)) return true;
 
@@ -86,7 +139,7 @@ namespace MARAS {
         }
 
         // Helper: Format list of FormIDs for logging
-        std::string FormatFormIDList(const std::vector<RE::FormID>& formIDs) {
+        std::string FormatFormIDList(std::span<const RE::FormID> formIDs) {
             std::ostringstream ss;
             for (size_t i = 0; i < formIDs.size(); ++i) {
                 if (i) ss << ", ";
@@ -97,23 +150,93 @@ namespace MARAS {
 
     }  // namespace
 
+    void FlatFormIDMultimap::Build(std::vector<std::pair<RE::FormID, RE::FormID>>& pairs) {
+        Clear();
+
+        // Stable so each key's values keep their input (scan) order
+        std::stable_sort(pairs.begin(), pairs.end(),
+                         [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        values_.reserve(pairs.size());
+        for (const auto& [key, value] : pairs) {
+            if (keys_.empty() || keys_.back() != key) {
+                keys_.push_back(key);
+                offsets_.push_back(static_cast<std::uint32_t>(values_.size()));
+            }
+            values_.push_back(value);
+        }
+        offsets_.push_back(static_cast<std::uint32_t>(values_.size()));
+
+        keys_.shrink_to_fit();
+        offsets_.shrink_to_fit();
+    }
+
+    void FlatFormIDMultimap::Clear() {
+        keys_.clear();
+        offsets_.clear();
+        values_.clear();
+    }
+
+    std::span<const RE::FormID> FlatFormIDMultimap::Find(RE::FormID key) const {
+        auto it = std::lower_bound(keys_.begin(), keys_.end(), key);
+        if (it == keys_.end() || *it != key) return {};
+        return ValuesAt(static_cast<std::size_t>(it - keys_.begin()));
+    }
+
+    std::span<const RE::FormID> FlatFormIDMultimap::ValuesAt(std::size_t keyIndex) const {
+        if (keyIndex >= keys_.size()) return {};
+        return std::span<const RE::FormID>(values_).subspan(offsets_[keyIndex],
+                                                            offsets_[keyIndex + 1] - offsets_[keyIndex]);
+    }
+
+    std::size_t FlatFormIDMultimap::MemoryBytes() const {
+        return keys_.capacity() * sizeof(RE::FormID) + offsets_.capacity() * sizeof(std::uint32_t) +
+               values_.capacity() * sizeof(RE::FormID);
+    }
+
     HomeCellService& HomeCellService::GetSingleton() {
         static HomeCellService instance;
         return instance;
     }
 
-    HomeCellService::HomeCellService() {
-        homeCells_.clear();
-        actorsWithHome_.clear();
-        bedsWithOwners_.clear();
+    HomeCellService::HomeCellService() { Clear(); }
+
+    void HomeCellService::Clear() {
+        cellIds_.clear();
+        cellCenterMarkers_.clear();
+        cellDoors_.Clear();
+        actorIds_.clear();
+        actorHomeCells_.clear();
+        bedsWithOwners_.Clear();
+        cellActors_.Clear();
+        cellBeds_.Clear();
     }
 
     void HomeCellService::BuildIndex() {
-        homeCells_.clear();
-        actorsWithHome_.clear();
-        bedsWithOwners_.clear();
+        Clear();
+
+        using Clock = std::chrono::high_resolution_clock;
+        auto start = Clock::now();
 
-        auto start = std::chrono::high_resolution_clock::now();
+        const std::filesystem::path cachePath = kIndexCachePath;
+        const std::uint64_t loadOrderHash = ComputeLoadOrderHash();
+        if (loadOrderHash != 0 && LoadIndexCache(cachePath, loadOrderHash)) {
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count();
+            MARAS_LOG_INFO("HomeCellService: loaded index for {} cells from cache in {} ms ({} KB)", cellIds_.size(),
+                           ms, MemoryBytes() / 1024);
+            return;
+        }
+
+        ScanInteriorCells();
+
+        if (loadOrderHash != 0) {
+            SaveIndexCache(cachePath, loadOrderHash);
+        }
+    }
+
+    void HomeCellService::ScanInteriorCells() {
+        using Clock = std::chrono::high_resolution_clock;
+        auto start = Clock::now();
 
         auto* dataHandler = RE::TESDataHandler::GetSingleton();
         if (!dataHandler) {
@@ -121,39 +244,94 @@ namespace MARAS {
             return;
         }
 
-        size_t scanned = 0;
+        ScanContext ctx;
+        ctx.kwDwelling = LookupKeyword(KEYWORD_DWELLING);
+        ctx.kwHouse = LookupKeyword(KEYWORD_HOUSE);
+        ctx.centerMarkerType = RE::TESForm::LookupByID<RE::BGSLocationRefType>(LOCATION_CENTER_MARKER);
 
-        // Iterate the interiorCells array directly, skipping null entries
+        // Phase 1: filter the interiorCells array down to home locations, skipping null entries
+        std::vector<RE::TESObjectCELL*> candidates;
+        size_t interiorCount = 0;
         for (auto* cell : dataHandler->interiorCells) {
             if (!cell) continue;
+            ++interiorCount;
+            if (IsHomeLocation(cell->GetLocation(), ctx.kwDwelling, ctx.kwHouse)) {
+                candidates.push_back(cell);
+            }
+        }
+        auto filtered = Clock::now();
+
+        // Phase 2: scan candidates in fixed-size chunks. Workers claim chunks from a shared counter and
+        // write into their chunk's own result, so no locking is needed and the merge order is stable.
+        const size_t chunkCount = (candidates.size() + kScanChunkSize - 1) / kScanChunkSize;
+        std::vector<ScanResult> results(chunkCount);
+        std::atomic<size_t> nextChunk{0};
+
+        auto worker = [&]() {
+            for (size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++) {
+                const size_t begin = chunk * kScanChunkSize;
+                const size_t end = std::min(begin + kScanChunkSize, candidates.size());
+                auto& out = results[chunk];
+                for (size_t i = begin; i < end; ++i) {
+                    HomeCellData hdata;
+                    if (ScanCell(candidates[i], ctx, hdata, out)) {
+                        out.cells.emplace_back(candidates[i]->GetFormID(), std::move(hdata));
+                    }
+                }
+            }
+        };
 
-            auto location = cell->GetLocation();
-            if (!IsHomeLocation(location)) continue;
-
-            // Scan cell contents (single pass) - fills out hdata and records beds/actors
-            HomeCellData hdata;
-            bool hasPersistentActor = ScanCell(cell, hdata);
-            if (!hasPersistentActor) continue;
-
-            // Save the cell data
-            homeCells_[cell->GetFormID()] = std::move(hdata);
-            ++scanned;
+        size_t threadCount = 1;
+        if (candidates.size() >= kParallelScanThreshold) {
+            threadCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, chunkCount);
         }
 
-        auto end = std::chrono::high_resolution_clock::now();
-        auto dur = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-        MARAS_LOG_INFO("HomeCellService: built index for {} cells in {} ms", scanned, dur);
+        std::vector<std::thread> pool;
+        pool.reserve(threadCount - 1);
+        try {
+            for (size_t t = 1; t < threadCount; ++t) {
+                pool.emplace_back(worker);
+            }
+        } catch (const std::system_error& e) {
+            MARAS_LOG_WARN("HomeCellService: started only {} of {} scan threads: {}", pool.size() + 1, threadCount,
+                           e.what());
+        }
+        worker();  // the calling thread takes chunks too
+        for (auto& thread : pool) {
+            thread.join();
+        }
+        auto scannedAt = Clock::now();
+
+        // Phase 3: concatenate chunk results in cell order, then sort and pack them into the flat tables
+        ScanResult merged;
+        for (auto& result : results) {
+            std::move(result.cells.begin(), result.cells.end(), std::back_inserter(merged.cells));
+            merged.actorHomes.insert(merged.actorHomes.end(), result.actorHomes.begin(), result.actorHomes.end());
+            merged.ownedBeds.insert(merged.ownedBeds.end(), result.ownedBeds.begin(), result.ownedBeds.end());
+            merged.cellBeds.insert(merged.cellBeds.end(), result.cellBeds.begin(), result.cellBeds.end());
+        }
+        Freeze(merged);
+        auto end = Clock::now();
+
+        auto ms = [](Clock::time_point from, Clock::time_point to) {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(to - from).count();
+        };
+        MARAS_LOG_INFO("HomeCellService: built index for {} cells in {} ms ({} KB)", cellIds_.size(), ms(start, end),
+                       MemoryBytes() / 1024);
+        MARAS_LOG_INFO(
+            "HomeCellService: filter {} ms ({} of {} interior cells are homes), scan {} ms ({} threads), merge {} ms",
+            ms(start, filtered), candidates.size(), interiorCount, ms(filtered, scannedAt), pool.size() + 1,
+            ms(scannedAt, end));
 
         // LogIndex();
     }
 
-    bool HomeCellService::ScanCell(RE::TESObjectCELL* cell, HomeCellData& outData) {
+    bool HomeCellService::ScanCell(RE::TESObjectCELL* cell, const ScanContext& ctx, HomeCellData& outData,
+                                   ScanResult& out) {
         if (!cell) return false;
         RE::FormID cellId = cell->GetFormID();
 
         bool hasPersistentActor = false;
-        static RE::BGSLocationRefType* kLocationCenterLCRT =
-            RE::TESForm::LookupByID<RE::BGSLocationRefType>(LOCATION_CENTER_MARKER);
 
         bool foundCenterMarker = false;
 
@@ -174,14 +352,17 @@ namespace MARAS {
             if (base->formType == RE::FormType::Furniture) {
                 if (auto furn = base->As<RE::TESFurniture>()) {
                     if (IsBed(furn)) {
-                        ProcessBedOwnership(*ref);
+                        if (RE::TESForm* ownerForm = ref->extraList.GetOwner()) {
+                            out.ownedBeds.emplace_back(ownerForm->GetFormID(), ref->GetFormID());
+                            out.cellBeds.emplace_back(cellId, ref->GetFormID());
+                        }
                     }
                 }
             }
 
             // Process LocationCenterMarker: XMarker with ExtraLocationRefType (always takes priority)
             if (auto* lrt = ref->extraList.GetByType<RE::ExtraLocationRefType>()) {
-                if (lrt->locRefType == kLocationCenterLCRT) {
+                if (lrt->locRefType == ctx.centerMarkerType) {
                     outData.centerMarker = ref->GetFormID();
                     foundCenterMarker = true;
                 }
@@ -195,7 +376,7 @@ namespace MARAS {
             // Process persistent actor references
             if (ref->IsPersistent() && base->formType == RE::FormType::NPC) {
                 hasPersistentActor = true;
-                ProcessActorHome(ref->GetFormID(), cellId);
+                out.actorHomes.emplace_back(ref->GetFormID(), cellId);
             }
 
             return RE::BSContainer::ForEachResult::kContinue;
@@ -209,29 +390,238 @@ namespace MARAS {
         return hasPersistentActor;
     }
 
-    void HomeCellService::ProcessBedOwnership(RE::TESObjectREFR& bedRef) {
-        RE::TESForm* ownerForm = bedRef.extraList.GetOwner();
-        if (!ownerForm) return;
+    void HomeCellService::Freeze(ScanResult& result) {
+        Clear();
+
+        // Cells: each cell is scanned once, so keys are unique; the stable sort keeps the first on duplicates
+        auto byKey = [](const auto& a, const auto& b) { return a.first < b.first; };
+        std::stable_sort(result.cells.begin(), result.cells.end(), byKey);
+        std::vector<std::pair<RE::FormID, RE::FormID>> doorPairs;
+        cellIds_.reserve(result.cells.size());
+        cellCenterMarkers_.reserve(result.cells.size());
+        for (const auto& [cellId, hdata] : result.cells) {
+            if (!cellIds_.empty() && cellIds_.back() == cellId) continue;
+            cellIds_.push_back(cellId);
+            cellCenterMarkers_.push_back(hdata.centerMarker);
+            for (auto door : hdata.doors) {
+                doorPairs.emplace_back(cellId, door);
+            }
+        }
+        cellDoors_.Build(doorPairs);
+
+        // Actors: stable sort keeps scan order within an actor, so the first home seen wins
+        std::stable_sort(result.actorHomes.begin(), result.actorHomes.end(), byKey);
+        actorIds_.reserve(result.actorHomes.size());
+        actorHomeCells_.reserve(result.actorHomes.size());
+        for (const auto& [actorId, cellId] : result.actorHomes) {
+            if (!actorIds_.empty() && actorIds_.back() == actorId) continue;
+            actorIds_.push_back(actorId);
+            actorHomeCells_.push_back(cellId);
+        }
+        actorIds_.shrink_to_fit();
+        actorHomeCells_.shrink_to_fit();
+
+        bedsWithOwners_.Build(result.ownedBeds);
+
+        // Reverse adjacency: cell -> actors is derived from the frozen actor table (actors sorted by FormID)
+        std::vector<std::pair<RE::FormID, RE::FormID>> actorsByCell;
+        actorsByCell.reserve(actorIds_.size());
+        for (std::size_t i = 0; i < actorIds_.size(); ++i) {
+            actorsByCell.emplace_back(actorHomeCells_[i], actorIds_[i]);
+        }
+        cellActors_.Build(actorsByCell);
+        cellBeds_.Build(result.cellBeds);
+    }
+
+    std::size_t HomeCellService::FindCell(RE::FormID cellId) const {
+        auto it = std::lower_bound(cellIds_.begin(), cellIds_.end(), cellId);
+        return (it != cellIds_.end() && *it == cellId) ? static_cast<std::size_t>(it - cellIds_.begin())
+                                                       : cellIds_.size();
+    }
+
+    std::size_t HomeCellService::MemoryBytes() const {
+        return (cellIds_.capacity() + cellCenterMarkers_.capacity() + actorIds_.capacity() +
+                actorHomeCells_.capacity()) *
+                   sizeof(RE::FormID) +
+               cellDoors_.MemoryBytes() + bedsWithOwners_.MemoryBytes() + cellActors_.MemoryBytes() +
+               cellBeds_.MemoryBytes();
+    }
+
+    std::uint64_t HomeCellService::ComputeLoadOrderHash() {
+        auto* dataHandler = RE::TESDataHandler::GetSingleton();
+        if (!dataHandler) return 0;
+
+        std::uint64_t hash = kFnvOffsetBasis;
+        HashValue(hash, kIndexCacheVersion);
+
+        for (auto* file : dataHandler->files) {
+            if (!file || file->GetCompileIndex() == 0xFF) continue;  // not active
+
+            auto name = file->GetFilename();
+            HashBytes(hash, name.data(), name.size());
+            HashValue(hash, file->GetCompileIndex());
+            HashValue(hash, file->GetSmallFileCompileIndex());
+
+            // Size and timestamp catch a plugin being edited or updated in place
+            std::error_code ec;
+            auto pluginPath = std::filesystem::path("Data") / std::filesystem::path(name);
+            std::uintmax_t size = std::filesystem::file_size(pluginPath, ec);
+            if (ec) size = 0;
+            auto modified = std::filesystem::last_write_time(pluginPath, ec);
+            std::int64_t modifiedTicks = ec ? 0 : static_cast<std::int64_t>(modified.time_since_epoch().count());
+            HashValue(hash, size);
+            HashValue(hash, modifiedTicks);
+        }
+
+        return hash;
+    }
+
+    bool HomeCellService::LoadIndexCache(const std::filesystem::path& path, std::uint64_t loadOrderHash) {
+        try {
+            std::ifstream in(path, std::ios::binary);
+            if (!in.is_open()) {
+                MARAS_LOG_INFO("HomeCellService: no index cache at {}, scanning cells", path.string());
+                return false;
+            }
+
+            const std::vector<char> bytes{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+            CacheReader reader{bytes.data(), bytes.data() + bytes.size()};
+
+            std::uint32_t magic = 0, version = 0;
+            std::uint64_t hash = 0;
+            std::uint32_t cellCount = 0, actorCount = 0, bedCount = 0, cellBedCount = 0;
+            if (!reader.Read(magic) || !reader.Read(version) || !reader.Read(hash) || !reader.Read(cellCount) ||
+                !reader.Read(actorCount) || !reader.Read(bedCount) || !reader.Read(cellBedCount)) {
+                MARAS_LOG_WARN("HomeCellService: index cache header is truncated, rebuilding");
+                return false;
+            }
+            if (magic != kIndexCacheMagic || version != kIndexCacheVersion) {
+                MARAS_LOG_INFO("HomeCellService: index cache format {} is outdated, rebuilding", version);
+                return false;
+            }
+            if (hash != loadOrderHash) {
+                MARAS_LOG_INFO("HomeCellService: load order changed since index cache was written, rebuilding");
+                return false;
+            }
+
+            // Decode into a scratch result first so a corrupt file leaves the index untouched
+            ScanResult result;
+            result.cells.reserve(cellCount);
+            for (std::uint32_t i = 0; i < cellCount; ++i) {
+                RE::FormID cellId = 0;
+                std::uint32_t doorCount = 0;
+                HomeCellData hdata;
+                if (!reader.Read(cellId) || !reader.Read(hdata.centerMarker) || !reader.Read(doorCount) ||
+                    doorCount > reader.Remaining() / sizeof(RE::FormID)) {
+                    MARAS_LOG_WARN("HomeCellService: index cache is corrupt (cell {} of {}), rebuilding", i, cellCount);
+                    return false;
+                }
+                hdata.doors.resize(doorCount);
+                for (auto& door : hdata.doors) {
+                    reader.Read(door);
+                }
+                result.cells.emplace_back(cellId, std::move(hdata));
+            }
+
+            auto readPairs = [&](std::uint32_t count, std::vector<std::pair<RE::FormID, RE::FormID>>& out) {
+                if (count > reader.Remaining() / (2 * sizeof(RE::FormID))) return false;
+                out.resize(count);
+                for (auto& [first, second] : out) {
+                    reader.Read(first);
+                    reader.Read(second);
+                }
+                return true;
+            };
+            if (!readPairs(actorCount, result.actorHomes) || !readPairs(bedCount, result.ownedBeds) ||
+                !readPairs(cellBedCount, result.cellBeds) || reader.Remaining() != 0) {
+                MARAS_LOG_WARN("HomeCellService: index cache is corrupt, rebuilding");
+                return false;
+            }
 
-        RE::FormID ownerId = ownerForm->GetFormID();
-        RE::FormID bedRefId = bedRef.GetFormID();
-        bedsWithOwners_[ownerId].push_back(bedRefId);
+            Freeze(result);
+            return true;
+        } catch (const std::exception& e) {
+            MARAS_LOG_ERROR("HomeCellService::LoadIndexCache exception: {}", e.what());
+            Clear();
+            return false;
+        }
     }
 
-    void HomeCellService::ProcessActorHome(RE::FormID actorFormId, RE::FormID cellId) {
-        // Insert only if not already present
-        if (actorsWithHome_.find(actorFormId) == actorsWithHome_.end()) {
-            ActorHomeData adata;
-            adata.homeCell = cellId;
-            actorsWithHome_.emplace(actorFormId, std::move(adata));
+    bool HomeCellService::SaveIndexCache(const std::filesystem::path& path, std::uint64_t loadOrderHash) const {
+        using Clock = std::chrono::high_resolution_clock;
+        auto start = Clock::now();
+
+        try {
+            std::vector<char> buffer;
+            AppendValue(buffer, kIndexCacheMagic);
+            AppendValue(buffer, kIndexCacheVersion);
+            AppendValue(buffer, loadOrderHash);
+            AppendValue(buffer, static_cast<std::uint32_t>(cellIds_.size()));
+            AppendValue(buffer, static_cast<std::uint32_t>(actorIds_.size()));
+            AppendValue(buffer, static_cast<std::uint32_t>(bedsWithOwners_.ValueCount()));
+            AppendValue(buffer, static_cast<std::uint32_t>(cellBeds_.ValueCount()));
+
+            for (std::size_t i = 0; i < cellIds_.size(); ++i) {
+                auto doors = cellDoors_.Find(cellIds_[i]);
+                AppendValue(buffer, cellIds_[i]);
+                AppendValue(buffer, cellCenterMarkers_[i]);
+                AppendValue(buffer, static_cast<std::uint32_t>(doors.size()));
+                for (auto door : doors) {
+                    AppendValue(buffer, door);
+                }
+            }
+            for (std::size_t i = 0; i < actorIds_.size(); ++i) {
+                AppendValue(buffer, actorIds_[i]);
+                AppendValue(buffer, actorHomeCells_[i]);
+            }
+            for (std::size_t i = 0; i < bedsWithOwners_.KeyCount(); ++i) {
+                const RE::FormID ownerId = bedsWithOwners_.Keys()[i];
+                for (auto bedRefId : bedsWithOwners_.ValuesAt(i)) {
+                    AppendValue(buffer, ownerId);
+                    AppendValue(buffer, bedRefId);
+                }
+            }
+            for (std::size_t i = 0; i < cellBeds_.KeyCount(); ++i) {
+                const RE::FormID cellId = cellBeds_.Keys()[i];
+                for (auto bedRefId : cellBeds_.ValuesAt(i)) {
+                    AppendValue(buffer, cellId);
+                    AppendValue(buffer, bedRefId);
+                }
+            }
+
+            // Write next to the target and rename over it, so a crash mid-write never leaves a torn cache
+            std::filesystem::create_directories(path.parent_path());
+            auto tmpPath = path;
+            tmpPath += ".tmp";
+            {
+                std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+                if (!out.is_open()) {
+                    MARAS_LOG_WARN("HomeCellService: failed to open {} for writing", tmpPath.string());
+                    return false;
+                }
+                out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                if (!out) {
+                    MARAS_LOG_WARN("HomeCellService: failed to write index cache to {}", tmpPath.string());
+                    return false;
+                }
+            }
+            std::filesystem::rename(tmpPath, path);
+
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count();
+            MARAS_LOG_INFO("HomeCellService: wrote index cache ({} bytes) to {} in {} ms", buffer.size(), path.string(),
+                           ms);
+            return true;
+        } catch (const std::exception& e) {
+            MARAS_LOG_ERROR("HomeCellService::SaveIndexCache exception: {}", e.what());
+            return false;
         }
     }
 
     RE::FormID HomeCellService::GetNpcHome(RE::Actor* npc) const {
         if (!npc) return 0;
 
-        auto it = actorsWithHome_.find(npc->GetFormID());
-        return (it != actorsWithHome_.end()) ? it->second.homeCell : 0;
+        auto it = std::lower_bound(actorIds_.begin(), actorIds_.end(), npc->GetFormID());
+        return (it != actorIds_.end() && *it == npc->GetFormID()) ? actorHomeCells_[it - actorIds_.begin()] : 0;
     }
 
     RE::FormID HomeCellService::GetNpcOriginalHouseCenterMarker(RE::Actor* npc) const {
@@ -245,69 +635,81 @@ namespace MARAS {
         }
 
         // Lookup the cell data to get the center marker
-        auto it = homeCells_.find(cellId);
-        if (it == homeCells_.end()) {
+        auto pos = FindCell(cellId);
+        if (pos == cellIds_.size()) {
             MARAS_LOG_INFO("GetNpcOriginalHouseCenterMarker: Cell {:08X} not found in index", cellId);
             return 0;
         }
 
-        RE::FormID markerId = it->second.centerMarker;
+        RE::FormID markerId = cellCenterMarkers_[pos];
         MARAS_LOG_INFO("GetNpcOriginalHouseCenterMarker: NPC {:08X} -> Cell {:08X} -> Marker {:08X}", npc->GetFormID(),
                        cellId, markerId);
         return markerId;
     }
 
-    std::vector<RE::FormID> HomeCellService::GetNpcBeds(RE::Actor* npc) const {
+    std::span<const RE::FormID> HomeCellService::GetNpcBeds(RE::Actor* npc) const {
         if (!npc) return {};
 
         // Get the NPC's base form (TESNpc) since bed ownership is stored by base form ID
         auto baseForm = npc->GetActorBase();
         if (!baseForm) return {};
 
-        auto it = bedsWithOwners_.find(baseForm->GetFormID());
-        return (it != bedsWithOwners_.end()) ? it->second : std::vector<RE::FormID>{};
+        return bedsWithOwners_.Find(baseForm->GetFormID());
     }
 
-    std::vector<RE::FormID> HomeCellService::GetCellDoors(RE::FormID cellFormID) const {
-        auto it = homeCells_.find(cellFormID);
-        return (it != homeCells_.end()) ? it->second.doors : std::vector<RE::FormID>{};
+    std::span<const RE::FormID> HomeCellService::GetCellDoors(RE::FormID cellFormID) const {
+        return cellDoors_.Find(cellFormID);
+    }
+
+    std::span<const RE::FormID> HomeCellService::GetCellActors(RE::FormID cellFormID) const {
+        return cellActors_.Find(cellFormID);
+    }
+
+    std::span<const RE::FormID> HomeCellService::GetCellBeds(RE::FormID cellFormID) const {
+        return cellBeds_.Find(cellFormID);
     }
 
     void HomeCellService::Revert() {
-        homeCells_.clear();
-        actorsWithHome_.clear();
-        bedsWithOwners_.clear();
+        Clear();
         MARAS_LOG_INFO("HomeCellService: reverted index");
     }
 
     void HomeCellService::LogIndex() const {
-        MARAS_LOG_INFO("HomeCellService: logging index ({} cells, {} actors, {} owners)", homeCells_.size(),
-                       actorsWithHome_.size(), bedsWithOwners_.size());
+        using Clock = std::chrono::high_resolution_clock;
+        auto start = Clock::now();
 
-        for (const auto& [cellId, cellData] : homeCells_) {
+        MARAS_LOG_INFO("HomeCellService: logging index ({} cells, {} actors, {} owners)", cellIds_.size(),
+                       actorIds_.size(), bedsWithOwners_.KeyCount());
+
+        for (std::size_t i = 0; i < cellIds_.size(); ++i) {
+            const RE::FormID cellId = cellIds_[i];
+            const RE::FormID centerMarker = cellCenterMarkers_[i];
             auto cellForm = RE::TESForm::LookupByID(cellId);
             auto cell = cellForm ? cellForm->As<RE::TESObjectCELL>() : nullptr;
 
             std::string cellName = GetFormName(cell);
             std::string locStr = GetLocationInfo(cell);
-            std::string doorsStr = FormatFormIDList(cellData.doors);
+            std::string doorsStr = FormatFormIDList(cellDoors_.Find(cellId));
             std::string actorsStr = GetActorsInCell(cellId);
             std::string bedsStr = GetBedsInCell(cellId);
-            std::string markerStr = cellData.centerMarker ? FormatFormID(cellData.centerMarker) : "(none)";
+            std::string markerStr = centerMarker ? FormatFormID(centerMarker) : "(none)";
 
             MARAS_LOG_INFO("Cell {:08X} '{}' loc={} marker={} doors=[{}] actors=[{}] beds=[{}]", cellId, cellName,
                            locStr, markerStr, doorsStr, actorsStr, bedsStr);
         }
 
         // Log actors with their beds
-        MARAS_LOG_INFO("HomeCellService: actor to beds mapping ({} actors with beds):", bedsWithOwners_.size());
-        for (const auto& [actorId, bedList] : bedsWithOwners_) {
-            std::string bedsStr = FormatFormIDList(bedList);
-            MARAS_LOG_INFO("  Actor {:08X} has beds=[{}]", actorId, bedsStr);
+        MARAS_LOG_INFO("HomeCellService: actor to beds mapping ({} actors with beds):", bedsWithOwners_.KeyCount());
+        for (std::size_t i = 0; i < bedsWithOwners_.KeyCount(); ++i) {
+            std::string bedsStr = FormatFormIDList(bedsWithOwners_.ValuesAt(i));
+            MARAS_LOG_INFO("  Actor {:08X} has beds=[{}]", bedsWithOwners_.Keys()[i], bedsStr);
         }
-        if (bedsWithOwners_.empty()) {
+        if (bedsWithOwners_.KeyCount() == 0) {
             MARAS_LOG_INFO("  (no beds with owners found)");
         }
+
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count();
+        MARAS_LOG_INFO("HomeCellService: logged index in {} ms", ms);
     }
 
     std::string HomeCellService::GetLocationInfo(const RE::TESObjectCELL* cell) const {
@@ -325,31 +727,11 @@ namespace MARAS {
     }
 
     std::string HomeCellService::GetActorsInCell(RE::FormID cellId) const {
-        std::vector<RE::FormID> actors;
-        for (const auto& [actorId, homeData] : actorsWithHome_) {
-            if (homeData.homeCell == cellId) {
-                actors.push_back(actorId);
-            }
-        }
-        return FormatFormIDList(actors);
+        return FormatFormIDList(GetCellActors(cellId));
     }
 
     std::string HomeCellService::GetBedsInCell(RE::FormID cellId) const {
-        std::vector<RE::FormID> beds;
-        for (const auto& [ownerId, bedList] : bedsWithOwners_) {
-            for (auto bedRefId : bedList) {
-                if (auto form = RE::TESForm::LookupByID(bedRefId)) {
-                    if (auto ref = form->As<RE::TESObjectREFR>()) {
-                        if (auto parentCell = ref->GetParentCell()) {
-                            if (parentCell->GetFormID() == cellId) {
-                                beds.push_back(bedRefId);
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        return FormatFormIDList(beds);
+        return FormatFormIDList(GetCellBeds(cellId));
     }
 
 }  // namespace MARAS
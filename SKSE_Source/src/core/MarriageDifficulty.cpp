@@ -3,7 +3,6 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
-#include <cctype>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
@@ -18,8 +17,13 @@
 namespace MARAS {
 
     // Static member initialization
-    std::unordered_map<std::string, float> MarriageDifficulty::config_;
-    bool MarriageDifficulty::configLoaded_ = false;
+    std::atomic<std::shared_ptr<const DifficultyParams>> MarriageDifficulty::params_{
+        std::make_shared<const DifficultyParams>()};
+    std::mutex MarriageDifficulty::standingMutex_;
+    std::optional<MarriageDifficulty::PlayerStandingSnapshot> MarriageDifficulty::standing_;
+    std::vector<RE::FormID> MarriageDifficulty::standingQuests_;
+    std::atomic<std::uint64_t> MarriageDifficulty::standingHits_{0};
+    std::atomic<std::uint64_t> MarriageDifficulty::standingMisses_{0};
 
     namespace {
         // Helper: Get FormCache singleton
@@ -39,6 +43,15 @@ namespace MARAS {
             return quest && quest->GetCurrentStageID() >= stage;
         }
 
+        // Helper: Thane quests of the nine holds; a hold counts once its quest reaches kThaneStage
+        constexpr std::uint32_t kThaneStage = 25;
+        std::array<RE::TESQuest*, 9> GetThaneQuests() {
+            auto& cache = GetCache();
+            return {cache.GetEastmarchThane(),  cache.GetFalkreathThane(), cache.GetHaafingarThane(),
+                    cache.GetHjaalmarchThane(), cache.GetPaleThane(),      cache.GetReachThane(),
+                    cache.GetRiftThane(),       cache.GetWhiterunThane(),  cache.GetWinterholdThane()};
+        }
+
         // Helper: Convert difficulty to success chance using sigmoid curve for smoother transitions
         // Options:
         // - Linear: simple inversion (current)
@@ -69,6 +82,63 @@ namespace MARAS {
             float GetStrongest() const { return (-bestNegative > bestPositive) ? bestNegative : bestPositive; }
         };
 
+        // JSON location of every scalar parameter: section, key, and the field it compiles into
+        struct ParamField {
+            const char* section;
+            const char* key;
+            float DifficultyParams::*field;
+        };
+
+        constexpr ParamField kParamFields[] = {
+            {"difficultyCalculation", "sigmoidSteepness", &DifficultyParams::sigmoidSteepness},
+            {"difficultyCalculation", "sigmoidCenter", &DifficultyParams::sigmoidCenter},
+            {"difficultyCalculation", "difficultyClampMin", &DifficultyParams::difficultyClampMin},
+            {"difficultyCalculation", "difficultyClampMax", &DifficultyParams::difficultyClampMax},
+
+            {"complexity", "initialComplexity", &DifficultyParams::initialComplexity},
+            {"complexity", "levelDiffClampMin", &DifficultyParams::levelDiffClampMin},
+            {"complexity", "levelDiffClampMax", &DifficultyParams::levelDiffClampMax},
+
+            {"prestige", "dragonbornBonus", &DifficultyParams::prestigeDragonbornBonus},
+            {"prestige", "thaneHoldValue", &DifficultyParams::prestigeThaneHoldValue},
+            {"prestige", "maxThaneHolds", &DifficultyParams::prestigeMaxThaneHolds},
+            {"prestige", "guildLeaderBonus", &DifficultyParams::prestigeGuildLeaderBonus},
+            {"prestige", "mostGoldDivisor", &DifficultyParams::prestigeMostGoldDivisor},
+            {"prestige", "mostGoldClampMax", &DifficultyParams::prestigeMostGoldClampMax},
+            {"prestige", "houseUnitMultiplier", &DifficultyParams::prestigeHouseUnitMultiplier},
+            {"prestige", "horseUnitMultiplier", &DifficultyParams::prestigeHorseUnitMultiplier},
+            {"prestige", "houseHorseClampMax", &DifficultyParams::prestigeHouseHorseClampMax},
+            {"prestige", "questsMultiplier", &DifficultyParams::prestigeQuestsMultiplier},
+            {"prestige", "dungeonsMultiplier", &DifficultyParams::prestigeDungeonsMultiplier},
+            {"prestige", "soulsMultiplier", &DifficultyParams::prestigeSoulsMultiplier},
+            {"prestige", "renownClampMax", &DifficultyParams::prestigeRenownClampMax},
+            {"prestige", "prestigeClampMin", &DifficultyParams::prestigeClampMin},
+            {"prestige", "prestigeClampMax", &DifficultyParams::prestigeClampMax},
+            {"prestige", "targetBase", &DifficultyParams::prestigeTargetBase},
+            {"prestige", "targetPerSocialIndexMultiplier", &DifficultyParams::prestigeTargetPerSocialIndexMultiplier},
+            {"prestige", "deltaMultiplier", &DifficultyParams::prestigeDeltaMultiplier},
+
+            {"penalties", "jiltedPenalty", &DifficultyParams::jiltedPenalty},
+            {"penalties", "divorcedPenalty", &DifficultyParams::divorcedPenalty},
+            {"penalties", "playerKillerPenalty", &DifficultyParams::playerKillerPenalty},
+
+            {"multipliers", "marriedCountMultiplier", &DifficultyParams::marriedCountMultiplier},
+            {"multipliers", "divorcedCountMultiplier", &DifficultyParams::divorcedCountMultiplier},
+            {"multipliers", "levelDiffMultiplier", &DifficultyParams::levelDiffMultiplier},
+            {"multipliers", "speechcraftMultiplier", &DifficultyParams::speechcraftMultiplier},
+            {"multipliers", "relationshipRankMultiplier", &DifficultyParams::relationshipRankMultiplier},
+            {"multipliers", "affectionMultiplier", &DifficultyParams::affectionMultiplier},
+
+            {"guilds", "sameGuildBonus", &DifficultyParams::sameGuildBonus},
+        };
+
+        // Guild sections, in DifficultyParams::Guild order, and social class keys, in SocialClass order
+        constexpr std::array<const char*, DifficultyParams::kGuildCount> kGuildKeys = {
+            "companions", "thieves", "brotherhood", "college", "bards"};
+        constexpr std::array<const char*, DifficultyParams::kSocialClassCount> kSocialClassKeys = {
+            "outcast", "poverty", "working", "middle", "wealthy", "religious", "nobles", "rulers"};
+        static_assert(kSocialClassKeys.size() == static_cast<std::size_t>(SocialClass::_Count));
+
     }  // namespace
 
     float MarriageDifficulty::CalculateMarriageSuccessChance(RE::Actor* npc, float intimacyAdjustment, float mostGold,
@@ -84,90 +154,179 @@ namespace MARAS {
 
         MARAS_LOG_DEBUG("Calculating marriage success chance for NPC: {}", npc->GetDisplayFullName());
 
+        // One snapshot per evaluation; a concurrent reload swaps in a new block without touching this one
+        const auto paramsPtr = GetParams();
+        const DifficultyParams& params = *paramsPtr;
+
+        PlayerTerms terms;
+        if (!CapturePlayerTerms(params, mostGold, housesOwned, horsesOwned, questsCompleted, dungeonsCleared,
+                                dragonSoulsCollected, playerKiller, terms)) {
+            return 0.0f;
+        }
+
+        float difficulty = 0.0f;
+        float chance = EvaluateChance(params, terms, npc, intimacyAdjustment, difficulty);
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+
+        MARAS_LOG_INFO(
+            "Marriage difficulty calculation completed for {} in {} microseconds (chance: {:.3f}; difficulty: {:.2f})",
+            npc->GetDisplayFullName(), duration.count(), chance, difficulty);
+
+        return chance;
+    }
+
+    std::vector<float> MarriageDifficulty::CalculateMarriageSuccessChances(
+        std::span<RE::Actor* const> npcs, std::span<const float> intimacyAdjustments, float mostGold,
+        float housesOwned, float horsesOwned, float questsCompleted, float dungeonsCleared, float dragonSoulsCollected,
+        bool playerKiller) {
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        std::vector<float> chances(npcs.size(), 0.0f);
+        if (npcs.empty()) return chances;
+
+        const auto paramsPtr = GetParams();
+        const DifficultyParams& params = *paramsPtr;
+
+        PlayerTerms terms;
+        if (!CapturePlayerTerms(params, mostGold, housesOwned, horsesOwned, questsCompleted, dungeonsCleared,
+                                dragonSoulsCollected, playerKiller, terms)) {
+            return chances;
+        }
+
+        std::size_t evaluated = 0;
+        for (std::size_t i = 0; i < npcs.size(); ++i) {
+            auto npc = npcs[i];
+            if (!npc) continue;
+
+            const float intimacy = i < intimacyAdjustments.size() ? intimacyAdjustments[i] : 0.0f;
+            float difficulty = 0.0f;
+            chances[i] = EvaluateChance(params, terms, npc, intimacy, difficulty);
+            ++evaluated;
+
+            MARAS_LOG_DEBUG("Marriage chance for {}: {:.3f} (difficulty: {:.2f})", npc->GetDisplayFullName(),
+                            chances[i], difficulty);
+        }
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+
+        MARAS_LOG_INFO("Marriage difficulty batch completed for {} of {} NPCs in {} microseconds", evaluated,
+                       npcs.size(), duration.count());
+
+        return chances;
+    }
+
+    bool MarriageDifficulty::CapturePlayerTerms(const DifficultyParams& params, float mostGold, float housesOwned,
+                                                float horsesOwned, float questsCompleted, float dungeonsCleared,
+                                                float dragonSoulsCollected, bool playerKiller, PlayerTerms& out) {
         auto player = RE::PlayerCharacter::GetSingleton();
         if (!player) {
             MARAS_LOG_ERROR("Player is null");
-            return 0.0f;
+            return false;
         }
 
-        int npcLevel = npc->GetLevel();
-        int playerLevel = player->GetLevel();
-        float levelDiff = static_cast<float>(npcLevel - playerLevel);
+        out.playerBase = player->GetActorBase();
+        out.level = player->GetLevel();
+
+        const auto standing = GetPlayerStanding();
+        out.prestige = CalculatePlayerPrestige(params, standing, mostGold, housesOwned, horsesOwned, questsCompleted,
+                                               dungeonsCleared, dragonSoulsCollected);
+        out.playerKiller = playerKiller;
+
+        // Spouse count penalty
+        int married = CountMarried();
+        out.marriedScore = married * params.marriedCountMultiplier;
+        MARAS_LOG_DEBUG("Married count: {}, score: {}", married, out.marriedScore);
+
+        // Divorced count penalty
+        int divorced = CountDivorced();
+        out.divorcedScore = divorced * params.divorcedCountMultiplier;
+        MARAS_LOG_DEBUG("Divorced count: {}, score: {}", divorced, out.divorcedScore);
+
+        // Speech bonus
+        float speechcraft = player->AsActorValueOwner()->GetActorValue(RE::ActorValue::kSpeech);
+        out.speechScore = params.speechcraftMultiplier * speechcraft;
+        MARAS_LOG_DEBUG("Speechcraft value: {}, score: {}", speechcraft, out.speechScore);
+
+        // Guild membership; the Bards College counts once its quest line reaches stage 300
+        auto& cache = GetCache();
+        out.guildFactions = {cache.GetCompanionsFaction(), cache.GetThievesFaction(), cache.GetBrotherhoodFaction(),
+                             cache.GetCollegeFaction(), cache.GetBardsFaction()};
+        for (std::size_t g = 0; g < DifficultyParams::kGuildCount; ++g) {
+            auto faction = out.guildFactions[g];
+            out.inGuild[g] = faction && player->IsInFaction(faction);
+        }
+        out.inGuild[DifficultyParams::kBards] = standing.bardsMember;
+
+        return true;
+    }
+
+    float MarriageDifficulty::EvaluateChance(const DifficultyParams& params, const PlayerTerms& terms,
+                                             RE::Actor* npc, float intimacyAdjustment, float& difficulty) {
+        float levelDiff = static_cast<float>(npc->GetLevel() - terms.level);
 
         // Get social class directly as enum and cast to int for index
         auto& manager = NPCRelationshipManager::GetSingleton();
         int socialClassIndex = static_cast<int>(manager.GetSocialClass(npc->GetFormID()));
 
         // === 1. Complexity sum ===
-        float complexity = GetParam("initialComplexity");
+        float complexity = params.initialComplexity;
 
         // Prestige delta
-        float target =
-            GetParam("prestigeTargetBase") + GetParam("prestigeTargetPerSocialIndexMultiplier") * socialClassIndex;
-        float playerPrestige = CalculatePlayerPrestige(mostGold, housesOwned, horsesOwned, questsCompleted,
-                                                       dungeonsCleared, dragonSoulsCollected);
-        float pDelta = (target - playerPrestige) * GetParam("prestigeDeltaMultiplier");
+        float target = params.prestigeTargetBase + params.prestigeTargetPerSocialIndexMultiplier * socialClassIndex;
+        float pDelta = (target - terms.prestige) * params.prestigeDeltaMultiplier;
         complexity += pDelta;
 
-        MARAS_LOG_DEBUG("Target prestige: {}, Player prestige: {}, Delta: {}", target, playerPrestige, pDelta);
+        MARAS_LOG_DEBUG("Target prestige: {}, Player prestige: {}, Delta: {}", target, terms.prestige, pDelta);
 
         // Jilted penalty
         if (IsJilted(npc)) {
-            complexity += GetParam("jiltedPenalty");
+            complexity += params.jiltedPenalty;
             MARAS_LOG_DEBUG("Applied jilted penalty");
         }
 
         // Divorced penalty
         if (IsDivorced(npc)) {
-            complexity += GetParam("divorcedPenalty");
+            complexity += params.divorcedPenalty;
             MARAS_LOG_DEBUG("Applied divorced penalty");
         }
 
         // Player killer penalty
-        if (playerKiller) {
-            complexity += GetParam("playerKillerPenalty");
+        if (terms.playerKiller) {
+            complexity += params.playerKillerPenalty;
             MARAS_LOG_DEBUG("Applied player killer penalty");
         }
 
-        // Spouse count penalty
-        float marriedScore = CountMarried() * GetParam("marriedCountMultiplier");
-        MARAS_LOG_DEBUG("Married count: {}, score: {}", CountMarried(), marriedScore);
-        complexity += marriedScore;
-
-        // Divorced count penalty
-        float divorcedScore = CountDivorced() * GetParam("divorcedCountMultiplier");
-        MARAS_LOG_DEBUG("Divorced count: {}, score: {}", CountDivorced(), divorcedScore);
-        complexity += divorcedScore;
+        complexity += terms.marriedScore;
+        complexity += terms.divorcedScore;
 
         // Level difference
-        float levelDiffScore = std::clamp(levelDiff * GetParam("levelDiffMultiplier"), GetParam("levelDiffClampMin"),
-                                          GetParam("levelDiffClampMax"));
+        float levelDiffScore = std::clamp(levelDiff * params.levelDiffMultiplier, params.levelDiffClampMin,
+                                          params.levelDiffClampMax);
         MARAS_LOG_DEBUG("Level difference: {}, score: {}", levelDiff, levelDiffScore);
         complexity += levelDiffScore;
 
-        // Speech bonus
-        float speechcraft = player->AsActorValueOwner()->GetActorValue(RE::ActorValue::kSpeech);
-        float speechScore = GetParam("speechcraftMultiplier") * speechcraft;
-        MARAS_LOG_DEBUG("Speechcraft value: {}, score: {}", speechcraft, speechScore);
-        complexity += speechScore;
+        complexity += terms.speechScore;
 
         // Relationship rank bonus - get actual relationship rank between NPC and player
         int relationshipRank = 0;
         if (auto npcBase = npc->GetActorBase()) {
-            if (auto playerBase = player->GetActorBase()) {
-                if (auto relationship = RE::BGSRelationship::GetRelationship(npcBase, playerBase)) {
+            if (terms.playerBase) {
+                if (auto relationship = RE::BGSRelationship::GetRelationship(npcBase, terms.playerBase)) {
                     relationshipRank = static_cast<int>(relationship->level.underlying());
                 }
             }
         }
 
-        float relationshipScore = GetParam("relationshipRankMultiplier") * static_cast<float>(relationshipRank);
+        float relationshipScore = params.relationshipRankMultiplier * static_cast<float>(relationshipRank);
         complexity += relationshipScore;
 
         MARAS_LOG_DEBUG("Relationship rank: {}, score: {}", relationshipRank, relationshipScore);
 
         // Guild alignment
-        float guildAlignment = CalculateGuildAlignmentMod(npc);
+        float guildAlignment = CalculateGuildAlignmentMod(params, terms, npc);
         complexity += guildAlignment;
         MARAS_LOG_DEBUG("Guild alignment score: {}", guildAlignment);
 
@@ -178,7 +337,7 @@ namespace MARAS {
         // Affection adjustment (permanent affection 0..100, baseline 50)
         // Values above 50 reduce complexity (improve chance), below 50 increase complexity (worsen chance)
         int permanentAffection = AffectionService::GetSingleton().GetPermanentAffection(npc->GetFormID());
-        float affectionMultiplier = GetParam("affectionMultiplier");
+        float affectionMultiplier = params.affectionMultiplier;
         float affectionAdjustment = (static_cast<float>(permanentAffection) - 50.0f) * affectionMultiplier;
         complexity -= affectionAdjustment;
         MARAS_LOG_DEBUG("Permanent affection: {}, multiplier: {}, adjustment applied: {}", permanentAffection,
@@ -187,19 +346,10 @@ namespace MARAS {
         MARAS_LOG_DEBUG("Final complexity: {}", complexity);
 
         // === 2. Clamp difficulty 0-100 ===
-        float difficulty = ClampValue(complexity, GetParam("difficultyClampMin"), GetParam("difficultyClampMax"));
+        difficulty = ClampValue(complexity, params.difficultyClampMin, params.difficultyClampMax);
 
         // === 3. Calculate success chance using sigmoid curve for smoother transitions ===
-        float chance = DifficultyToChance(difficulty, GetParam("sigmoidSteepness"), GetParam("sigmoidCenter"));
-
-        auto endTime = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
-
-        MARAS_LOG_INFO(
-            "Marriage difficulty calculation completed for {} in {} microseconds (chance: {:.3f}; difficulty: {:.2f})",
-            npc->GetDisplayFullName(), duration.count(), chance, difficulty);
-
-        return chance;
+        return DifficultyToChance(difficulty, params.sigmoidSteepness, params.sigmoidCenter);
     }
 
     bool MarriageDifficulty::CheckQuestStage(RE::TESQuest* quest, std::uint32_t stage) {
@@ -224,120 +374,37 @@ namespace MARAS {
             nlohmann::json j;
             in >> j;
 
-            config_.clear();
-
-            // Load difficulty calculation parameters
-            if (j.contains("difficultyCalculation")) {
-                auto& dc = j["difficultyCalculation"];
-                if (dc.contains("sigmoidSteepness")) config_["sigmoidSteepness"] = dc["sigmoidSteepness"].get<float>();
-                if (dc.contains("sigmoidCenter")) config_["sigmoidCenter"] = dc["sigmoidCenter"].get<float>();
-                if (dc.contains("difficultyClampMin"))
-                    config_["difficultyClampMin"] = dc["difficultyClampMin"].get<float>();
-                if (dc.contains("difficultyClampMax"))
-                    config_["difficultyClampMax"] = dc["difficultyClampMax"].get<float>();
-            }
-
-            // Load complexity parameters
-            if (j.contains("complexity")) {
-                auto& c = j["complexity"];
-                if (c.contains("initialComplexity")) config_["initialComplexity"] = c["initialComplexity"].get<float>();
-                if (c.contains("levelDiffClampMin")) config_["levelDiffClampMin"] = c["levelDiffClampMin"].get<float>();
-                if (c.contains("levelDiffClampMax")) config_["levelDiffClampMax"] = c["levelDiffClampMax"].get<float>();
-            }
-
-            // Load prestige parameters with renamed keys to match old naming
-            if (j.contains("prestige")) {
-                auto& p = j["prestige"];
-                if (p.contains("dragonbornBonus"))
-                    config_["prestigeDragonbornBonus"] = p["dragonbornBonus"].get<float>();
-                if (p.contains("thaneHoldValue")) config_["prestigeThaneHoldValue"] = p["thaneHoldValue"].get<float>();
-                if (p.contains("maxThaneHolds")) config_["prestigeMaxThaneHolds"] = p["maxThaneHolds"].get<float>();
-                if (p.contains("guildLeaderBonus"))
-                    config_["prestigeGuildLeaderBonus"] = p["guildLeaderBonus"].get<float>();
-                if (p.contains("mostGoldDivisor"))
-                    config_["prestigeMostGoldDivisor"] = p["mostGoldDivisor"].get<float>();
-                if (p.contains("mostGoldClampMax"))
-                    config_["prestigeMostGoldClampMax"] = p["mostGoldClampMax"].get<float>();
-                if (p.contains("houseUnitMultiplier"))
-                    config_["prestigeHouseUnitMultiplier"] = p["houseUnitMultiplier"].get<float>();
-                if (p.contains("horseUnitMultiplier"))
-                    config_["prestigeHorseUnitMultiplier"] = p["horseUnitMultiplier"].get<float>();
-                if (p.contains("houseHorseClampMax"))
-                    config_["prestigeHouseHorseClampMax"] = p["houseHorseClampMax"].get<float>();
-                if (p.contains("questsMultiplier"))
-                    config_["prestigeQuestsMultiplier"] = p["questsMultiplier"].get<float>();
-                if (p.contains("dungeonsMultiplier"))
-                    config_["prestigeDungeonsMultiplier"] = p["dungeonsMultiplier"].get<float>();
-                if (p.contains("soulsMultiplier"))
-                    config_["prestigeSoulsMultiplier"] = p["soulsMultiplier"].get<float>();
-                if (p.contains("renownClampMax")) config_["prestigeRenownClampMax"] = p["renownClampMax"].get<float>();
-                if (p.contains("prestigeClampMin"))
-                    config_["prestigePrestigeClamp_min"] = p["prestigeClampMin"].get<float>();
-                if (p.contains("prestigeClampMax"))
-                    config_["prestigePrestigeClamp_max"] = p["prestigeClampMax"].get<float>();
-                if (p.contains("targetBase")) config_["prestigeTargetBase"] = p["targetBase"].get<float>();
-                if (p.contains("targetPerSocialIndexMultiplier"))
-                    config_["prestigeTargetPerSocialIndexMultiplier"] =
-                        p["targetPerSocialIndexMultiplier"].get<float>();
-                if (p.contains("deltaMultiplier"))
-                    config_["prestigeDeltaMultiplier"] = p["deltaMultiplier"].get<float>();
-            }
-
-            // Load penalties
-            if (j.contains("penalties")) {
-                auto& pen = j["penalties"];
-                if (pen.contains("jiltedPenalty")) config_["jiltedPenalty"] = pen["jiltedPenalty"].get<float>();
-                if (pen.contains("divorcedPenalty")) config_["divorcedPenalty"] = pen["divorcedPenalty"].get<float>();
-                if (pen.contains("playerKillerPenalty"))
-                    config_["playerKillerPenalty"] = pen["playerKillerPenalty"].get<float>();
-            }
-
-            // Load multipliers
-            if (j.contains("multipliers")) {
-                auto& m = j["multipliers"];
-                if (m.contains("marriedCountMultiplier"))
-                    config_["marriedCountMultiplier"] = m["marriedCountMultiplier"].get<float>();
-                if (m.contains("divorcedCountMultiplier"))
-                    config_["divorcedCountMultiplier"] = m["divorcedCountMultiplier"].get<float>();
-                if (m.contains("levelDiffMultiplier"))
-                    config_["levelDiffMultiplier"] = m["levelDiffMultiplier"].get<float>();
-                if (m.contains("speechcraftMultiplier"))
-                    config_["speechcraftMultiplier"] = m["speechcraftMultiplier"].get<float>();
-                if (m.contains("relationshipRankMultiplier"))
-                    config_["relationshipRankMultiplier"] = m["relationshipRankMultiplier"].get<float>();
-                if (m.contains("affectionMultiplier"))
-                    config_["affectionMultiplier"] = m["affectionMultiplier"].get<float>();
+            // Compile into a fresh block; keys missing from the file stay 0
+            auto params = std::make_shared<DifficultyParams>();
+            std::size_t loaded = 0;
+
+            for (const auto& param : kParamFields) {
+                auto section = j.find(param.section);
+                if (section != j.end() && section->contains(param.key)) {
+                    (*params).*param.field = (*section)[param.key].get<float>();
+                    ++loaded;
+                } else {
+                    MARAS_LOG_WARN("MarriageDifficulty: parameter '{}.{}' not found in config, using 0.0",
+                                   param.section, param.key);
+                }
             }
 
-            // Load guild parameters
-            if (j.contains("guilds")) {
-                auto& guilds = j["guilds"];
-                if (guilds.contains("sameGuildBonus"))
-                    config_["guild_sameGuildBonus"] = guilds["sameGuildBonus"].get<float>();
-
-                // Load each guild's social class modifiers
-                const std::vector<std::string> guildNames = {"companions", "thieves", "brotherhood", "college",
-                                                             "bards"};
-                const std::vector<std::string> socialClasses = {"outcast", "poverty",   "working", "middle",
-                                                                "wealthy", "religious", "nobles",  "rulers"};
-
-                for (const auto& guildName : guildNames) {
-                    if (guilds.contains(guildName)) {
-                        auto& guild = guilds[guildName];
-                        for (const auto& socialClass : socialClasses) {
-                            if (guild.contains(socialClass)) {
-                                std::string key = "guild" + std::string(1, static_cast<char>(std::toupper(static_cast<unsigned char>(guildName[0])))) +
-                                                  guildName.substr(1) + "_" + socialClass;
-                                config_[key] = guild[socialClass].get<float>();
-                            }
+            // Each guild's social class modifiers; absent entries contribute no modifier
+            if (auto guilds = j.find("guilds"); guilds != j.end()) {
+                for (std::size_t g = 0; g < kGuildKeys.size(); ++g) {
+                    auto guild = guilds->find(kGuildKeys[g]);
+                    if (guild == guilds->end()) continue;
+                    for (std::size_t c = 0; c < kSocialClassKeys.size(); ++c) {
+                        if (guild->contains(kSocialClassKeys[c])) {
+                            params->guildModifiers[g][c] = (*guild)[kSocialClassKeys[c]].get<float>();
+                            ++loaded;
                         }
                     }
                 }
             }
 
-            configLoaded_ = true;
-            MARAS_LOG_INFO("MarriageDifficulty: loaded {} configuration parameters from {}", config_.size(),
-                           path.string());
+            params_.store(std::move(params));
+            MARAS_LOG_INFO("MarriageDifficulty: loaded {} configuration parameters from {}", loaded, path.string());
             return true;
 
         } catch (const std::exception& e) {
@@ -346,29 +413,12 @@ namespace MARAS {
         }
     }
 
-    float MarriageDifficulty::GetParam(const std::string& param) {
-        auto it = config_.find(param);
-        if (it != config_.end()) {
-            return it->second;
-        }
-
-        MARAS_LOG_WARN("Parameter '{}' not found in config, returning 0.0f", param);
-        return 0.0f;
-    }
+    std::shared_ptr<const DifficultyParams> MarriageDifficulty::GetParams() { return params_.load(); }
 
     int MarriageDifficulty::GetThaneHolds() {
-        constexpr std::uint32_t THANE_STAGE = 25;
-        auto& cache = GetCache();
-
-        // Array of thane quest getters
-        RE::TESQuest* thaneQuests[] = {
-            cache.GetEastmarchThane(),  cache.GetFalkreathThane(), cache.GetHaafingarThane(),
-            cache.GetHjaalmarchThane(), cache.GetPaleThane(),      cache.GetReachThane(),
-            cache.GetRiftThane(),       cache.GetWhiterunThane(),  cache.GetWinterholdThane()};
-
         int totalHolds = 0;
-        for (auto* quest : thaneQuests) {
-            if (QuestReachedStage(quest, THANE_STAGE)) {
+        for (auto* quest : GetThaneQuests()) {
+            if (QuestReachedStage(quest, kThaneStage)) {
                 ++totalHolds;
             }
         }
@@ -382,9 +432,68 @@ namespace MARAS {
                QuestReachedStage(cache.GetThievesQuest(), 40);
     }
 
-    float MarriageDifficulty::CalculatePlayerPrestige(float mostGold, float housesOwned, float horsesOwned,
-                                                      float questsCompleted, float dungeonsCleared,
-                                                      float dragonSoulsCollected) {
+    MarriageDifficulty::PlayerStandingSnapshot MarriageDifficulty::GetPlayerStanding() {
+        std::lock_guard lock(standingMutex_);
+        if (standing_) {
+            standingHits_.fetch_add(1, std::memory_order_relaxed);
+            return *standing_;
+        }
+
+        auto& cache = GetCache();
+        PlayerStandingSnapshot snapshot;
+        snapshot.dragonborn = QuestReachedStage(cache.GetDragonbornQuest(), 90);
+        snapshot.thaneHolds = GetThaneHolds();
+        snapshot.guildLeader = IsGuildLeader();
+        snapshot.bardsMember = QuestReachedStage(cache.GetBardsQuest(), 300);
+
+        // Remember which quests were read, so only their stage events invalidate the snapshot
+        standingQuests_.clear();
+        auto track = [](RE::TESQuest* quest) {
+            if (quest) standingQuests_.push_back(quest->GetFormID());
+        };
+        for (auto* quest : GetThaneQuests()) track(quest);
+        track(cache.GetCompanionsQuest());
+        track(cache.GetCollegeQuest());
+        track(cache.GetThievesQuest());
+        track(cache.GetBardsQuest());
+        track(cache.GetDragonbornQuest());
+
+        standing_ = snapshot;
+
+        const auto misses = standingMisses_.fetch_add(1, std::memory_order_relaxed) + 1;
+        const auto hits = standingHits_.load(std::memory_order_relaxed);
+        MARAS_LOG_DEBUG(
+            "Player standing rebuilt - dragonborn: {}, thane holds: {}, guild leader: {}, bard: {} (cache hits: {} of "
+            "{} queries)",
+            snapshot.dragonborn, snapshot.thaneHolds, snapshot.guildLeader, snapshot.bardsMember, hits, hits + misses);
+        return snapshot;
+    }
+
+    void MarriageDifficulty::OnQuestStageChanged(RE::FormID questFormID) {
+        std::lock_guard lock(standingMutex_);
+        if (!standing_ || std::ranges::find(standingQuests_, questFormID) == standingQuests_.end()) {
+            return;
+        }
+        standing_.reset();
+        MARAS_LOG_DEBUG("Player standing invalidated by stage change of quest {:08X}", questFormID);
+    }
+
+    void MarriageDifficulty::InvalidatePlayerStanding() {
+        std::lock_guard lock(standingMutex_);
+        standing_.reset();
+
+        const auto hits = standingHits_.load(std::memory_order_relaxed);
+        const auto misses = standingMisses_.load(std::memory_order_relaxed);
+        if (hits + misses > 0) {
+            MARAS_LOG_INFO("Player standing cache: {} hits, {} rebuilds ({:.1f}% hit rate)", hits, misses,
+                           100.0 * static_cast<double>(hits) / static_cast<double>(hits + misses));
+        }
+    }
+
+    float MarriageDifficulty::CalculatePlayerPrestige(const DifficultyParams& params,
+                                                      const PlayerStandingSnapshot& standing, float mostGold,
+                                                      float housesOwned, float horsesOwned, float questsCompleted,
+                                                      float dungeonsCleared, float dragonSoulsCollected) {
         float result = 0.0f;
 
         MARAS_LOG_DEBUG("Prestige inputs - gold: {}, houses: {}, horses: {}, quests: {}, dungeons: {}, souls: {}",
@@ -392,93 +501,78 @@ namespace MARAS {
 
         // Dragonborn status
         float dragonbornBonus = 0.0f;
-        if (QuestReachedStage(GetCache().GetDragonbornQuest(), 90)) {
-            dragonbornBonus = GetParam("prestigeDragonbornBonus");
+        if (standing.dragonborn) {
+            dragonbornBonus = params.prestigeDragonbornBonus;
             result += dragonbornBonus;
         }
         MARAS_LOG_DEBUG("Dragonborn bonus: {}", dragonbornBonus);
 
         // Thane holds
-        int thaneHolds = GetThaneHolds();
-        float thaneScore = thaneHolds * GetParam("prestigeThaneHoldValue");
+        int thaneHolds = standing.thaneHolds;
+        float thaneScore = thaneHolds * params.prestigeThaneHoldValue;
         result += thaneScore;
         MARAS_LOG_DEBUG("Thane holds: {}, score: {}", thaneHolds, thaneScore);
 
         // Guild leader
         float guildLeaderBonus = 0.0f;
-        if (IsGuildLeader()) {
-            guildLeaderBonus = GetParam("prestigeGuildLeaderBonus");
+        if (standing.guildLeader) {
+            guildLeaderBonus = params.prestigeGuildLeaderBonus;
             result += guildLeaderBonus;
         }
         MARAS_LOG_DEBUG("Guild leader bonus: {}", guildLeaderBonus);
 
         // Wealth
         float wealthScore =
-            ClampValue(mostGold / GetParam("prestigeMostGoldDivisor"), 0.0f, GetParam("prestigeMostGoldClampMax"));
+            ClampValue(mostGold / params.prestigeMostGoldDivisor, 0.0f, params.prestigeMostGoldClampMax);
         result += wealthScore;
         MARAS_LOG_DEBUG("Wealth score: {} (from {} gold)", wealthScore, mostGold);
 
         // Houses and horses
-        float houseHorseScore = housesOwned * GetParam("prestigeHouseUnitMultiplier") +
-                                horsesOwned * GetParam("prestigeHorseUnitMultiplier");
-        float houseHorseClamped = ClampValue(houseHorseScore, 0.0f, GetParam("prestigeHouseHorseClampMax"));
+        float houseHorseScore = housesOwned * params.prestigeHouseUnitMultiplier +
+                                horsesOwned * params.prestigeHorseUnitMultiplier;
+        float houseHorseClamped = ClampValue(houseHorseScore, 0.0f, params.prestigeHouseHorseClampMax);
         result += houseHorseClamped;
         MARAS_LOG_DEBUG("House/horse score: {} (clamped from {})", houseHorseClamped, houseHorseScore);
 
         // Heroic achievements
-        float heroicScore = questsCompleted * GetParam("prestigeQuestsMultiplier") +
-                            dungeonsCleared * GetParam("prestigeDungeonsMultiplier") +
-                            dragonSoulsCollected * GetParam("prestigeSoulsMultiplier");
-        float heroicClamped = ClampValue(heroicScore, 0.0f, GetParam("prestigeRenownClampMax"));
+        float heroicScore = questsCompleted * params.prestigeQuestsMultiplier +
+                            dungeonsCleared * params.prestigeDungeonsMultiplier +
+                            dragonSoulsCollected * params.prestigeSoulsMultiplier;
+        float heroicClamped = ClampValue(heroicScore, 0.0f, params.prestigeRenownClampMax);
         result += heroicClamped;
         MARAS_LOG_DEBUG("Heroic achievements score: {} (clamped from {}) - quests: {}, dungeons: {}, souls: {}",
-                        heroicClamped, heroicScore, questsCompleted * GetParam("prestigeQuestsMultiplier"),
-                        dungeonsCleared * GetParam("prestigeDungeonsMultiplier"),
-                        dragonSoulsCollected * GetParam("prestigeSoulsMultiplier"));
+                        heroicClamped, heroicScore, questsCompleted * params.prestigeQuestsMultiplier,
+                        dungeonsCleared * params.prestigeDungeonsMultiplier,
+                        dragonSoulsCollected * params.prestigeSoulsMultiplier);
 
         float finalPrestige =
-            ClampValue(result, GetParam("prestigePrestigeClamp_min"), GetParam("prestigePrestigeClamp_max"));
+            ClampValue(result, params.prestigeClampMin, params.prestigeClampMax);
         MARAS_LOG_DEBUG("Total prestige: {} (clamped from {})", finalPrestige, result);
 
         return finalPrestige;
     }
 
-    float MarriageDifficulty::CalculateGuildAlignmentMod(RE::Actor* npc) {
-        auto player = RE::PlayerCharacter::GetSingleton();
-        if (!player || !npc) return 0.0f;
+    float MarriageDifficulty::CalculateGuildAlignmentMod(const DifficultyParams& params, const PlayerTerms& terms,
+                                                         RE::Actor* npc) {
+        if (!npc) return 0.0f;
 
-        auto socialClass = GetManager().GetSocialClass(npc->GetFormID());
-        std::string spouseClass = Utils::ToLower(Utils::SocialClassToString(socialClass));
+        const auto classIndex = static_cast<std::size_t>(GetManager().GetSocialClass(npc->GetFormID()));
 
         GuildModifiers modifiers;
-        auto& cache = GetCache();
-
-        // Helper lambda to process guild faction
-        auto processGuild = [&](RE::TESFaction* faction, const std::string& guildName, bool checkQuest = false,
-                                RE::TESQuest* quest = nullptr, std::uint32_t stage = 0) {
-            // Skip if quest check required and quest hasn't reached stage
-            if (checkQuest && !QuestReachedStage(quest, stage)) return;
-
-            // Check if player is in guild (or quest-based membership)
-            bool playerInGuild = checkQuest || (faction && player->IsInFaction(faction));
-            if (!playerInGuild) return;
+        for (std::size_t g = 0; g < DifficultyParams::kGuildCount; ++g) {
+            if (!terms.inGuild[g]) continue;
 
             // Get and apply guild modifier for this social class
-            float modifier = GetParam(guildName + "_" + spouseClass);
+            float modifier =
+                classIndex < DifficultyParams::kSocialClassCount ? params.guildModifiers[g][classIndex] : 0.0f;
             modifiers.UpdateWith(modifier);
 
             // Check if NPC is also in same guild
+            auto faction = terms.guildFactions[g];
             if (faction && npc->IsInFaction(faction)) {
-                modifiers.sameGuild += GetParam("guild_sameGuildBonus");
+                modifiers.sameGuild += params.sameGuildBonus;
             }
-        };
-
-        // Process each guild
-        processGuild(cache.GetCompanionsFaction(), "guildCompanions");
-        processGuild(cache.GetThievesFaction(), "guildThieves");
-        processGuild(cache.GetBrotherhoodFaction(), "guildBrotherhood");
-        processGuild(cache.GetCollegeFaction(), "guildCollege");
-        processGuild(cache.GetBardsFaction(), "guildBards", true, cache.GetBardsQuest(), 300);
+        }
 
         return modifiers.GetStrongest() + modifiers.sameGuild;
     }
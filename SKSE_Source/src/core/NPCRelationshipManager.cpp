@@ -2,8 +2,11 @@
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <exception>
+#include <thread>
 
 #include "core/AffectionService.h"
 #include "core/FormCache.h"
@@ -21,6 +24,12 @@
 
 namespace MARAS {
 
+    namespace {
+        // Bulk registration: actors per classification work item, and the batch size worth starting threads for
+        constexpr std::size_t kClassifyChunkSize = 8;
+        constexpr std::size_t kParallelClassifyThreshold = 32;
+    }  // namespace
+
     NPCRelationshipManager& NPCRelationshipManager::GetSingleton() {
         static NPCRelationshipManager instance;
         return instance;
@@ -51,75 +60,141 @@ namespace MARAS {
         }
     }
 
-    void NPCRelationshipManager::RemoveFromAllBuckets(RE::FormID npcFormID) {
-        candidates.erase(npcFormID);
-        engaged.erase(npcFormID);
-        married.erase(npcFormID);
-        divorced.erase(npcFormID);
-        jilted.erase(npcFormID);
+    void NPCRelationshipManager::UpdateTrackedFactionRank(RE::FormID npcFormID, RelationshipStatus status) {
+        // Get the tracked NPC faction from the centralized cache
+        auto trackedFaction = FormCache::GetSingleton().GetTrackedFaction();
+        if (!trackedFaction) {
+            return;
+        }
+
+        std::int8_t rank = static_cast<std::int8_t>(status);
+        AddToFaction(npcFormID, trackedFaction, rank);
+
+        MARAS_LOG_INFO("Set tracked faction rank {} for NPC {:08X} (status: {})", rank, npcFormID,
+                       Utils::RelationshipStatusToString(status));
     }
 
-    void NPCRelationshipManager::AddToBucket(RE::FormID npcFormID, RelationshipStatus status) {
-        switch (status) {
-            case RelationshipStatus::Candidate:
-                candidates.insert(npcFormID);
-                break;
-            case RelationshipStatus::Engaged:
-                engaged.insert(npcFormID);
-                break;
-            case RelationshipStatus::Married:
-                married.insert(npcFormID);
-                break;
-            case RelationshipStatus::Divorced:
-                divorced.insert(npcFormID);
-                break;
-            case RelationshipStatus::Jilted:
-                jilted.insert(npcFormID);
-                break;
-            case RelationshipStatus::Unknown:
-            default:
-                break;
+    void NPCRelationshipManager::ApplyStatusSideEffects(RE::FormID npcFormID, RelationshipStatus status) {
+        if (IsBatching()) {
+            auto [it, inserted] = batchLastStatus.try_emplace(npcFormID, status);
+            if (inserted || it->second != status) {
+                it->second = status;
+                batchTransitions.emplace_back(npcFormID, status);
+            }
+            return;
+        }
+
+        // Update tracked faction rank and notify Papyrus
+        try {
+            UpdateTrackedFactionRank(npcFormID, status);
+            SendStatusChangedEvent(npcFormID, status);
+        } catch (const std::exception& e) {
+            MARAS_LOG_ERROR("UpdateTrackedFactionRank exception for {:08X}: {}", npcFormID, e.what());
+        }
+
+        // Manage faction membership based on relationship status
+        try {
+            ManageFactions(npcFormID, status);
+        } catch (const std::exception& e) {
+            MARAS_LOG_ERROR("ManageFactions exception for {:08X}: {}", npcFormID, e.what());
         }
     }
 
-    void NPCRelationshipManager::RemoveFromBucket(RE::FormID npcFormID, RelationshipStatus status) {
-        switch (status) {
-            case RelationshipStatus::Candidate:
-                candidates.erase(npcFormID);
-                break;
-            case RelationshipStatus::Engaged:
-                engaged.erase(npcFormID);
-                break;
-            case RelationshipStatus::Married:
-                married.erase(npcFormID);
-                break;
-            case RelationshipStatus::Divorced:
-                divorced.erase(npcFormID);
-                break;
-            case RelationshipStatus::Jilted:
-                jilted.erase(npcFormID);
-                break;
-            case RelationshipStatus::Unknown:
-            default:
-                break;
+    void NPCRelationshipManager::RequestGlobalsUpdate() {
+        globalsDirty = true;
+        if (!IsBatching()) {
+            FlushGlobals();
         }
     }
 
-    void NPCRelationshipManager::UpdateTrackedFactionRank(RE::FormID npcFormID, RelationshipStatus status) {
-        // Get the tracked NPC faction from the centralized cache
-        auto trackedFaction = FormCache::GetSingleton().GetTrackedFaction();
-        if (!trackedFaction) {
+    namespace {
+        bool IsLoveInterestStatus(RelationshipStatus status) {
+            return status == RelationshipStatus::Engaged || status == RelationshipStatus::Married;
+        }
+    }  // namespace
+
+    void NPCRelationshipManager::TrackStatusDelta(RelationshipStatus from, RelationshipStatus to) {
+        if (from == to) {
             return;
         }
 
-        std::int8_t rank = static_cast<std::int8_t>(status);
-        AddToFaction(npcFormID, trackedFaction, rank);
+        loveInterestCount += static_cast<std::int32_t>(IsLoveInterestStatus(to)) -
+                             static_cast<std::int32_t>(IsLoveInterestStatus(from));
+        spouseCount += static_cast<std::int32_t>(to == RelationshipStatus::Married) -
+                       static_cast<std::int32_t>(from == RelationshipStatus::Married);
+    }
 
-        // Send status changed event to Papyrus
-        SendStatusChangedEvent(npcFormID, status);
+    void NPCRelationshipManager::RecountCounters() {
+        spouseCount = static_cast<std::int32_t>(roster.CountByStatus(RelationshipStatus::Married));
+        loveInterestCount =
+            static_cast<std::int32_t>(roster.CountByStatus(RelationshipStatus::Engaged)) + spouseCount;
+    }
 
-        MARAS_LOG_INFO("Set tracked faction rank {} for NPC {:08X} (status: {})", rank, npcFormID,
-                       Utils::RelationshipStatusToString(status));
+    bool NPCRelationshipManager::AuditCounters() const {
+        auto married = static_cast<std::int32_t>(roster.CountByStatus(RelationshipStatus::Married));
+        auto loveInterests = static_cast<std::int32_t>(roster.CountByStatus(RelationshipStatus::Engaged)) + married;
+        if (loveInterestCount == loveInterests && spouseCount == married) {
+            return true;
+        }
+
+        MARAS_LOG_ERROR("Counter audit failed: loveInterests {} (buckets {}), spouses {} (buckets {})",
+                        loveInterestCount, loveInterests, spouseCount, married);
+        return false;
+    }
+
+    void NPCRelationshipManager::BeginBatch() { ++batchDepth; }
+
+    void NPCRelationshipManager::CommitBatch() {
+        if (batchDepth == 0) {
+            MARAS_LOG_WARN("CommitBatch called without a matching BeginBatch");
+            return;
+        }
+        if (--batchDepth > 0) {
+            return;
+        }
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        auto pending = std::move(batchTransitions);
+        batchTransitions.clear();
+        batchLastStatus.clear();
+
+        // Engine writes: the tracked-rank + status-faction pass for each transition, in order. Faction
+        // management depends on the transition (e.g. candidates join the marriage potential faction), so
+        // intermediate statuses are replayed rather than collapsed.
+        std::vector<std::pair<RE::FormID, RelationshipStatus>> events;
+        events.reserve(pending.size());
+        for (const auto& [npcFormID, status] : pending) {
+            if (!roster.Contains(npcFormID)) {
+                continue;  // unregistered before commit
+            }
+
+            try {
+                UpdateTrackedFactionRank(npcFormID, status);
+            } catch (const std::exception& e) {
+                MARAS_LOG_ERROR("UpdateTrackedFactionRank exception for {:08X}: {}", npcFormID, e.what());
+            }
+            try {
+                ManageFactions(npcFormID, status);
+            } catch (const std::exception& e) {
+                MARAS_LOG_ERROR("ManageFactions exception for {:08X}: {}", npcFormID, e.what());
+            }
+            events.emplace_back(npcFormID, status);
+        }
+
+        FlushGlobals();
+
+        // Papyrus notifications go out in one burst once all state is final
+        for (const auto& [npcFormID, status] : events) {
+            SendStatusChangedEvent(npcFormID, status);
+        }
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+        if (!events.empty()) {
+            MARAS_LOG_INFO("Committed status batch: {} transitions flushed in {} microseconds", events.size(),
+                           duration.count());
+        }
     }
 
     void NPCRelationshipManager::SendStatusChangedEvent(RE::FormID npcFormID, RelationshipStatus status) {
@@ -160,18 +235,13 @@ namespace MARAS {
             return false;
         }
 
-        // Remove from any previous buckets and add to desired status bucket
-        RemoveFromAllBuckets(npcFormID);
-        AddToBucket(npcFormID, status);
-
-        auto& data = npcData[npcFormID];
-        data.status = status;
+        // Move to the desired status bucket (updates the stored record too)
+        auto previousStatus = GetRelationshipStatus(npcFormID);
+        roster.SetStatus(npcFormID, status);
+        TrackStatusDelta(previousStatus, status);
 
-        // Update tracked faction rank
-        UpdateTrackedFactionRank(npcFormID, status);
-
-        // Manage faction membership based on relationship status
-        ManageFactions(npcFormID, status);
+        // Tracked faction rank, status factions and Papyrus event (deferred while batching)
+        ApplyStatusSideEffects(npcFormID, status);
 
         // Optional post-action (notify hierarchy, cleanup assets, etc.)
         if (postAction) {
@@ -184,7 +254,7 @@ namespace MARAS {
 
         MARAS_LOG_INFO("Set status for NPC {:08X} to {}", npcFormID, Utils::RelationshipStatusToString(status));
         // Recalculate and update TT_MARAS.esp globals that track love interests and spouses
-        RecalculateAndUpdateGlobals();
+        RequestGlobalsUpdate();
         return true;
     }
 
@@ -212,78 +282,203 @@ namespace MARAS {
         }
 
         // Automatically determine all attributes
-        SocialClass socialClass = DetermineSocialClass(npcFormID);
-        SkillType skillType = DetermineSkillType(npcFormID);
-        // Temperament depends on SC and ST; prefer override if present
-        Temperament temperament = [this, npcFormID, socialClass, skillType]() {
-            if (auto ov = GetTemperamentOverride(npcFormID); ov.has_value()) {
-                return Utils::StringToTemperament(ov.value());
-            }
-            return NPCTypeDeterminer::ComputeTemperament(socialClass, skillType);
-        }();
+        const auto attributes = ClassifyCandidate(NPCTypeDeterminer::SnapshotActor(actor));
+        if (!StoreCandidate(npcFormID, attributes)) {
+            return false;
+        }
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+
+        MARAS_LOG_INFO("Auto-registered NPC {} ({:08X}) as candidate in {} microseconds (SC: {}, ST: {}, T: {})",
+                       Utils::GetNPCName(npcFormID), npcFormID, duration.count(),
+                       Utils::SocialClassToString(attributes.socialClass),
+                       Utils::SkillTypeToString(attributes.skillType),
+                       Utils::TemperamentToString(attributes.temperament));
+
+        // Update globals in case registration affects tracked counts
+        RequestGlobalsUpdate();
 
-        // Add to master set
-        allRegistered.insert(npcFormID);
+        return true;
+    }
+
+    NPCRelationshipManager::CandidateAttributes NPCRelationshipManager::ClassifyCandidate(
+        const ActorSnapshot& snapshot) const {
+        CandidateAttributes attributes;
+        attributes.socialClass = NPCTypeDeterminer::DetermineSocialClass(
+            snapshot, [this](RE::FormID id) { return GetSocialClassOverride(id); });
+        attributes.skillType = NPCTypeDeterminer::DetermineSkillType(
+            snapshot, [this](RE::FormID id) { return GetSkillTypeOverride(id); });
 
-        // Add to candidate bucket
-        candidates.insert(npcFormID);
+        // Temperament depends on SC and ST; prefer override if present
+        if (auto ov = GetTemperamentOverride(snapshot.formID); ov.has_value()) {
+            attributes.temperament = Utils::StringToTemperament(ov.value());
+        } else {
+            attributes.temperament =
+                NPCTypeDeterminer::ComputeTemperament(attributes.socialClass, attributes.skillType);
+        }
+        return attributes;
+    }
 
-        // Store NPC data
+    bool NPCRelationshipManager::StoreCandidate(RE::FormID npcFormID, const CandidateAttributes& attributes) {
+        // Store NPC data (lands in the candidate bucket)
         try {
-            npcData[npcFormID] = NPCRelationshipData(npcFormID, socialClass, skillType, temperament);
+            NPCRelationshipData data(npcFormID, attributes.socialClass, attributes.skillType, attributes.temperament);
+            if (!roster.Insert(std::move(data))) {
+                MARAS_LOG_ERROR("Failed to store NPC data for {:08X}", npcFormID);
+                return false;
+            }
         } catch (const std::exception& e) {
             MARAS_LOG_ERROR("Exception while storing NPC data for {:08X}: {}", npcFormID, e.what());
             // Rollback registration to keep data consistent
-            allRegistered.erase(npcFormID);
-            candidates.erase(npcFormID);
+            roster.Erase(npcFormID);
             return false;
         }
 
+        // Affection recorded while the NPC was unregistered moves into its roster row
+        AffectionService::GetSingleton().AdoptNPCData(npcFormID);
+
         // Add to appropriate factions with enum values as ranks. Wrap calls in
         // try/catch to ensure that plugin doesn't crash the game if an engine call
         // fails or throws.
         try {
-            AddToSocialClassFaction(npcFormID, static_cast<std::int8_t>(socialClass));
+            AddToSocialClassFaction(npcFormID, static_cast<std::int8_t>(attributes.socialClass));
         } catch (const std::exception& e) {
             MARAS_LOG_ERROR("AddToSocialClassFaction exception for {:08X}: {}", npcFormID, e.what());
         }
         try {
-            AddToSkillTypeFaction(npcFormID, static_cast<std::int8_t>(skillType));
+            AddToSkillTypeFaction(npcFormID, static_cast<std::int8_t>(attributes.skillType));
         } catch (const std::exception& e) {
             MARAS_LOG_ERROR("AddToSkillTypeFaction exception for {:08X}: {}", npcFormID, e.what());
         }
         try {
-            AddToTemperamentFaction(npcFormID, static_cast<std::int8_t>(temperament));
+            AddToTemperamentFaction(npcFormID, static_cast<std::int8_t>(attributes.temperament));
         } catch (const std::exception& e) {
             MARAS_LOG_ERROR("AddToTemperamentFaction exception for {:08X}: {}", npcFormID, e.what());
         }
 
-        // Add to tracked faction with status as rank
-        try {
-            UpdateTrackedFactionRank(npcFormID, RelationshipStatus::Candidate);
-        } catch (const std::exception& e) {
-            MARAS_LOG_ERROR("UpdateTrackedFactionRank exception for {:08X}: {}", npcFormID, e.what());
+        // Add to tracked faction with status as rank and manage status-based faction membership
+        ApplyStatusSideEffects(npcFormID, RelationshipStatus::Candidate);
+        return true;
+    }
+
+    std::vector<NPCRelationshipManager::BulkRegisterResult> NPCRelationshipManager::RegisterCandidates(
+        std::span<RE::Actor* const> actors) {
+        using Clock = std::chrono::high_resolution_clock;
+        const auto startTime = Clock::now();
+
+        std::vector<BulkRegisterResult> results(actors.size(), BulkRegisterResult::Skipped);
+
+        // Snapshot: validate on the calling thread, keep the first occurrence of each new NPC and copy what
+        // classification reads from it, so the workers below never touch live actors
+        std::vector<std::size_t> pending;
+        std::vector<ActorSnapshot> snapshots;
+        std::unordered_set<RE::FormID> seen;
+        pending.reserve(actors.size());
+        snapshots.reserve(actors.size());
+        for (std::size_t i = 0; i < actors.size(); ++i) {
+            auto* actor = actors[i];
+            if (!actor || !actor->GetActorBase()) {
+                results[i] = BulkRegisterResult::Failed;
+                continue;
+            }
+            const auto npcFormID = actor->GetFormID();
+            if (actor->IsPlayerRef() || IsRegistered(npcFormID) || !seen.insert(npcFormID).second) {
+                continue;
+            }
+            pending.push_back(i);
+            snapshots.push_back(NPCTypeDeterminer::SnapshotActor(actor));
         }
 
-        // Manage status-based faction membership
+        // Classification: workers claim fixed-size chunks and write only their own slots
+        std::vector<CandidateAttributes> attributes(pending.size());
+        const std::size_t chunkCount = (pending.size() + kClassifyChunkSize - 1) / kClassifyChunkSize;
+        std::atomic<std::size_t> nextChunk{0};
+
+        auto worker = [&]() {
+            for (std::size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++) {
+                const std::size_t begin = chunk * kClassifyChunkSize;
+                const std::size_t end = std::min(begin + kClassifyChunkSize, pending.size());
+                for (std::size_t p = begin; p < end; ++p) {
+                    attributes[p] = ClassifyCandidate(snapshots[p]);
+                }
+            }
+        };
+
+        std::size_t threadCount = 1;
+        if (pending.size() >= kParallelClassifyThreshold) {
+            threadCount = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, chunkCount);
+        }
+
+        std::vector<std::thread> pool;
+        pool.reserve(threadCount - 1);
         try {
-            ManageFactions(npcFormID, RelationshipStatus::Candidate);
-        } catch (const std::exception& e) {
-            MARAS_LOG_ERROR("ManageFactions exception for {:08X}: {}", npcFormID, e.what());
+            for (std::size_t t = 1; t < threadCount; ++t) {
+                pool.emplace_back(worker);
+            }
+        } catch (const std::system_error& e) {
+            MARAS_LOG_WARN("RegisterCandidates: started only {} of {} classification threads: {}", pool.size() + 1,
+                           threadCount, e.what());
+        }
+        worker();  // the calling thread takes chunks too
+        for (auto& thread : pool) {
+            thread.join();
         }
+        const auto classifiedAt = Clock::now();
+
+        // Apply: roster inserts and attribute factions now; status factions, globals and events on commit
+        std::size_t registered = 0;
+        {
+            StatusTransitionBatch batch;
+            for (std::size_t p = 0; p < pending.size(); ++p) {
+                const auto index = pending[p];
+                if (StoreCandidate(actors[index]->GetFormID(), attributes[p])) {
+                    results[index] = BulkRegisterResult::Registered;
+                    ++registered;
+                } else {
+                    results[index] = BulkRegisterResult::Failed;
+                }
+            }
+            RequestGlobalsUpdate();
+        }
+        const auto endTime = Clock::now();
+
+        auto us = [](Clock::time_point from, Clock::time_point to) {
+            return std::chrono::duration_cast<std::chrono::microseconds>(to - from).count();
+        };
+        MARAS_LOG_INFO(
+            "Bulk-registered {} of {} actors as candidates in {} microseconds (classify {} us on {} threads, apply {} "
+            "us)",
+            registered, actors.size(), us(startTime, endTime), us(startTime, classifiedAt), pool.size() + 1,
+            us(classifiedAt, endTime));
+
+        return results;
+    }
 
-        auto endTime = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+    std::vector<RE::Actor*> NPCRelationshipManager::CollectLoadedCandidates() const {
+        std::vector<RE::Actor*> actors;
 
-        MARAS_LOG_INFO("Auto-registered NPC {} ({:08X}) as candidate in {} microseconds (SC: {}, ST: {}, T: {})",
-                       Utils::GetNPCName(npcFormID), npcFormID, duration.count(),
-                       Utils::SocialClassToString(socialClass), Utils::SkillTypeToString(skillType),
-                       Utils::TemperamentToString(temperament));
+        auto processLists = RE::ProcessLists::GetSingleton();
+        if (!processLists) {
+            MARAS_LOG_ERROR("ProcessLists is null");
+            return actors;
+        }
 
-        // Update globals in case registration affects tracked counts
-        RecalculateAndUpdateGlobals();
+        actors.reserve(processLists->highActorHandles.size());
+        for (auto& handle : processLists->highActorHandles) {
+            auto actor = handle.get();
+            if (!actor || !actor->Is3DLoaded() || actor->IsDeleted() || actor->IsDead()) continue;
+            if (actor->IsPlayerRef() || actor->IsChild() || !actor->GetActorBase()) continue;
 
-        return true;
+            auto race = actor->GetRace();
+            if (!race || !race->HasKeywordString("ActorTypeNPC")) continue;
+
+            if (!IsRegistered(actor->GetFormID())) {
+                actors.push_back(actor.get());
+            }
+        }
+
+        return actors;
     }
 
     bool NPCRelationshipManager::UnregisterNPC(MARAS::FormID npcFormID) {
@@ -292,14 +487,12 @@ namespace MARAS {
             return false;
         }
 
-        // Remove from master set
-        allRegistered.erase(npcFormID);
-
-        // Remove from all buckets
-        RemoveFromAllBuckets(npcFormID);
+        // Clear affection data while the roster slot that addresses it is still assigned
+        AffectionService::GetSingleton().RemoveNPCData(npcFormID);
 
-        // Remove data
-        npcData.erase(npcFormID);
+        // Remove data and bucket membership
+        TrackStatusDelta(GetRelationshipStatus(npcFormID), RelationshipStatus::Unknown);
+        roster.Erase(npcFormID);
 
         // Ensure spouse hierarchy is updated if this NPC was present
         SpouseHierarchyManager::GetSingleton().OnSpouseRemoved(npcFormID);
@@ -307,27 +500,34 @@ namespace MARAS {
         // Release any shared house/assets (important for deceased NPCs to clean up properly)
         SpouseAssetsService::GetSingleton().StopShareHouseWithPlayer(npcFormID);
 
-        // Clear affection data for this NPC
-        AffectionService::GetSingleton().RemoveNPCData(npcFormID);
-
         // Recalculate globals after removal
-        RecalculateAndUpdateGlobals();
+        RequestGlobalsUpdate();
         MARAS_LOG_INFO("Unregistered NPC {} ({:08X})", Utils::GetNPCName(npcFormID), npcFormID);
         return true;
     }
 
     // Status checks
-    bool NPCRelationshipManager::IsRegistered(RE::FormID npcFormID) const { return allRegistered.contains(npcFormID); }
+    bool NPCRelationshipManager::IsRegistered(RE::FormID npcFormID) const { return roster.Contains(npcFormID); }
 
-    bool NPCRelationshipManager::IsCandidate(RE::FormID npcFormID) const { return candidates.contains(npcFormID); }
+    bool NPCRelationshipManager::IsCandidate(RE::FormID npcFormID) const {
+        return GetRelationshipStatus(npcFormID) == RelationshipStatus::Candidate;
+    }
 
-    bool NPCRelationshipManager::IsEngaged(RE::FormID npcFormID) const { return engaged.contains(npcFormID); }
+    bool NPCRelationshipManager::IsEngaged(RE::FormID npcFormID) const {
+        return GetRelationshipStatus(npcFormID) == RelationshipStatus::Engaged;
+    }
 
-    bool NPCRelationshipManager::IsMarried(RE::FormID npcFormID) const { return married.contains(npcFormID); }
+    bool NPCRelationshipManager::IsMarried(RE::FormID npcFormID) const {
+        return GetRelationshipStatus(npcFormID) == RelationshipStatus::Married;
+    }
 
-    bool NPCRelationshipManager::IsDivorced(RE::FormID npcFormID) const { return divorced.contains(npcFormID); }
+    bool NPCRelationshipManager::IsDivorced(RE::FormID npcFormID) const {
+        return GetRelationshipStatus(npcFormID) == RelationshipStatus::Divorced;
+    }
 
-    bool NPCRelationshipManager::IsJilted(RE::FormID npcFormID) const { return jilted.contains(npcFormID); }
+    bool NPCRelationshipManager::IsJilted(RE::FormID npcFormID) const {
+        return GetRelationshipStatus(npcFormID) == RelationshipStatus::Jilted;
+    }
 
     // Status transitions
     bool NPCRelationshipManager::PromoteToEngaged(RE::FormID npcFormID) {
@@ -351,34 +551,32 @@ namespace MARAS {
     }
 
     // Bulk retrievals
-    std::vector<RE::FormID> NPCRelationshipManager::GetAllRegisteredNPCs() const {
-        return std::vector<RE::FormID>(allRegistered.begin(), allRegistered.end());
-    }
+    // Copying retrievals; prefer ViewByStatus/ForEachByStatus on hot paths
+    std::vector<RE::FormID> NPCRelationshipManager::GetAllRegisteredNPCs() const { return roster.All(); }
 
     std::vector<RE::FormID> NPCRelationshipManager::GetAllCandidates() const {
-        return std::vector<RE::FormID>(candidates.begin(), candidates.end());
+        return roster.ByStatus(RelationshipStatus::Candidate);
     }
 
     std::vector<RE::FormID> NPCRelationshipManager::GetAllEngaged() const {
-        return std::vector<RE::FormID>(engaged.begin(), engaged.end());
+        return roster.ByStatus(RelationshipStatus::Engaged);
     }
 
     std::vector<RE::FormID> NPCRelationshipManager::GetAllMarried() const {
-        return std::vector<RE::FormID>(married.begin(), married.end());
+        return roster.ByStatus(RelationshipStatus::Married);
     }
 
     std::vector<RE::FormID> NPCRelationshipManager::GetAllDivorced() const {
-        return std::vector<RE::FormID>(divorced.begin(), divorced.end());
+        return roster.ByStatus(RelationshipStatus::Divorced);
     }
 
     std::vector<RE::FormID> NPCRelationshipManager::GetAllJilted() const {
-        return std::vector<RE::FormID>(jilted.begin(), jilted.end());
+        return roster.ByStatus(RelationshipStatus::Jilted);
     }
 
     // Data access
     const NPCRelationshipData* NPCRelationshipManager::GetNPCData(RE::FormID npcFormID) const {
-        auto it = npcData.find(npcFormID);
-        return (it != npcData.end()) ? &it->second : nullptr;
+        return roster.Find(npcFormID);
     }
 
     RelationshipStatus NPCRelationshipManager::GetRelationshipStatus(RE::FormID npcFormID) const {
@@ -411,7 +609,7 @@ namespace MARAS {
             return false;
         }
 
-        auto& data = npcData[npcFormID];
+        auto& data = *roster.Find(npcFormID);
         data.homeMarker = markerFormID;
 
         // Create the linked reference relationship
@@ -429,45 +627,48 @@ namespace MARAS {
     }
 
     bool NPCRelationshipManager::AddTrackedKeyword(RE::FormID npcFormID, RE::FormID keywordFormID) {
-        auto it = npcData.find(npcFormID);
-        if (it == npcData.end()) {
+        auto data = roster.Find(npcFormID);
+        if (!data) {
             return false;
         }
-        it->second.addedKeywords.insert(keywordFormID);
+        data->addedKeywords.insert(keywordFormID);
         return true;
     }
 
     bool NPCRelationshipManager::RemoveTrackedKeyword(RE::FormID npcFormID, RE::FormID keywordFormID) {
-        auto it = npcData.find(npcFormID);
-        if (it == npcData.end()) {
+        auto data = roster.Find(npcFormID);
+        if (!data) {
             return false;
         }
-        it->second.addedKeywords.erase(keywordFormID);
+        data->addedKeywords.erase(keywordFormID);
         return true;
     }
 
     // Statistics
-    size_t NPCRelationshipManager::GetTotalRegisteredCount() const { return allRegistered.size(); }
+    size_t NPCRelationshipManager::GetTotalRegisteredCount() const { return roster.Size(); }
 
-    size_t NPCRelationshipManager::GetCandidateCount() const { return candidates.size(); }
+    size_t NPCRelationshipManager::GetCandidateCount() const {
+        return roster.CountByStatus(RelationshipStatus::Candidate);
+    }
 
-    size_t NPCRelationshipManager::GetEngagedCount() const { return engaged.size(); }
+    size_t NPCRelationshipManager::GetEngagedCount() const { return roster.CountByStatus(RelationshipStatus::Engaged); }
 
-    size_t NPCRelationshipManager::GetMarriedCount() const { return married.size(); }
+    size_t NPCRelationshipManager::GetMarriedCount() const { return roster.CountByStatus(RelationshipStatus::Married); }
 
-    size_t NPCRelationshipManager::GetDivorcedCount() const { return divorced.size(); }
+    size_t NPCRelationshipManager::GetDivorcedCount() const {
+        return roster.CountByStatus(RelationshipStatus::Divorced);
+    }
 
-    size_t NPCRelationshipManager::GetJiltedCount() const { return jilted.size(); }
+    size_t NPCRelationshipManager::GetJiltedCount() const { return roster.CountByStatus(RelationshipStatus::Jilted); }
 
     // Save/Load support
     void NPCRelationshipManager::Clear() {
-        allRegistered.clear();
-        candidates.clear();
-        engaged.clear();
-        married.clear();
-        divorced.clear();
-        jilted.clear();
-        npcData.clear();
+        roster.Clear();
+        batchTransitions.clear();
+        batchLastStatus.clear();
+        loveInterestCount = 0;
+        spouseCount = 0;
+        globalsDirty = true;
 
         MARAS_LOG_INFO("Cleared all NPC relationship data");
     }
@@ -485,14 +686,15 @@ namespace MARAS {
         }
 
         // Write the count of NPCs
-        std::uint32_t npcCount = static_cast<std::uint32_t>(npcData.size());
+        std::uint32_t npcCount = static_cast<std::uint32_t>(roster.Size());
         if (!serialization->WriteRecordData(npcCount)) {
             MARAS_LOG_ERROR("Failed to write NPC count");
             return false;
         }
 
         // Write each NPC's data
-        for (const auto& [formID, data] : npcData) {
+        for (auto formID : roster.All()) {
+            const auto& data = *roster.Find(formID);
             if (!serialization->WriteRecordData(formID) ||
                 !serialization->WriteRecordData(static_cast<std::uint8_t>(data.socialClass)) ||
                 !serialization->WriteRecordData(static_cast<std::uint8_t>(data.skillType)) ||
@@ -551,6 +753,7 @@ namespace MARAS {
         }
 
         MARAS_LOG_INFO("Loading {} NPC records (data version {})", npcCount, version);
+        roster.Reserve(npcCount);
 
         constexpr std::uint8_t kOldDeceasedValue = 5;
 
@@ -656,9 +859,10 @@ namespace MARAS {
             data.formID = newFormID;
             data.status = static_cast<RelationshipStatus>(statusValue);
 
-            npcData[newFormID] = data;
-            allRegistered.insert(newFormID);
-            AddToBucket(newFormID, data.status);
+            if (!roster.Insert(data)) {
+                MARAS_LOG_WARN("Duplicate NPC record {:08X} in save data, skipping", newFormID);
+                continue;
+            }
 
             // Recreate the SetLinkedRef relationship after loading from save
             if (data.homeMarker.has_value()) {
@@ -684,10 +888,11 @@ namespace MARAS {
             }
         }
 
-        MARAS_LOG_INFO("Successfully loaded {} NPC relationship records", npcData.size());
+        MARAS_LOG_INFO("Successfully loaded {} NPC relationship records", roster.Size());
 
-        // Recalculate globals to account for any skipped dead/invalid NPCs
-        RecalculateAndUpdateGlobals();
+        // Rebuild counters from the loaded buckets (also accounts for skipped dead/invalid NPCs)
+        RecountCounters();
+        RequestGlobalsUpdate();
 
         return true;
     }
@@ -708,24 +913,36 @@ namespace MARAS {
         MARAS_LOG_INFO("  Jilted: {}", GetJiltedCount());
     }
 
-    // Recalculate and update TT_MARAS.esp globals used by scripts (LoveInterestsCount and SpousesCount)
-    void NPCRelationshipManager::RecalculateAndUpdateGlobals() {
-        // Love interests = engaged + married (matches Papyrus behavior)
-        std::int32_t loveInterests = static_cast<std::int32_t>(engaged.size() + married.size());
-        std::int32_t spouses = static_cast<std::int32_t>(married.size());
+    // Push the running counters to the TT_MARAS.esp globals used by scripts (LoveInterestsCount and SpousesCount)
+    void NPCRelationshipManager::FlushGlobals() {
+        if (!globalsDirty) {
+            return;
+        }
+        globalsDirty = false;
+
+#ifndef NDEBUG
+        if (!AuditCounters()) {
+            RecountCounters();
+        }
+#endif
 
         auto& cache = FormCache::GetSingleton();
 
+        // Love interests = engaged + married (matches Papyrus behavior)
         if (auto globalLove = cache.GetLoveInterestsCount()) {
-            globalLove->value = static_cast<float>(loveInterests);
-            MARAS_LOG_DEBUG("Updated LoveInterestsCount global to {}", loveInterests);
+            if (globalLove->value != static_cast<float>(loveInterestCount)) {
+                globalLove->value = static_cast<float>(loveInterestCount);
+                MARAS_LOG_DEBUG("Updated LoveInterestsCount global to {}", loveInterestCount);
+            }
         } else {
             MARAS_LOG_WARN("Cannot update LoveInterestsCount global - form not found");
         }
 
         if (auto globalSpouses = cache.GetSpousesCount()) {
-            globalSpouses->value = static_cast<float>(spouses);
-            MARAS_LOG_DEBUG("Updated SpousesCount global to {}", spouses);
+            if (globalSpouses->value != static_cast<float>(spouseCount)) {
+                globalSpouses->value = static_cast<float>(spouseCount);
+                MARAS_LOG_DEBUG("Updated SpousesCount global to {}", spouseCount);
+            }
         } else {
             MARAS_LOG_WARN("Cannot update SpousesCount global - form not found");
         }
@@ -1028,7 +1245,7 @@ namespace MARAS {
         // Ensure NPC is registered so we have storage for it
         if (!EnsureRegistered(npcFormID)) return false;
 
-        auto& data = npcData[npcFormID];
+        auto& data = *roster.Find(npcFormID);
         data.socialClass = static_cast<SocialClass>(socialClass);
 
         // Update faction membership for social class
@@ -1046,7 +1263,7 @@ namespace MARAS {
 
         if (!EnsureRegistered(npcFormID)) return false;
 
-        auto& data = npcData[npcFormID];
+        auto& data = *roster.Find(npcFormID);
         data.skillType = static_cast<SkillType>(skillType);
 
         // Update faction membership for skill type
@@ -1064,7 +1281,7 @@ namespace MARAS {
 
         if (!EnsureRegistered(npcFormID)) return false;
 
-        auto& data = npcData[npcFormID];
+        auto& data = *roster.Find(npcFormID);
         data.temperament = static_cast<Temperament>(temperament);
 
         // Update faction membership for temperament
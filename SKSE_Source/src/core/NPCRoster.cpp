@@ -0,0 +1,157 @@
+#include <algorithm>
+
+#include "core/NPCRelationshipManager.h"
+
+namespace MARAS {
+
+    namespace {
+        bool SlotEntryLess(const std::pair<RE::FormID, std::uint32_t>& entry, RE::FormID id) { return entry.first < id; }
+    }  // namespace
+
+    std::uint32_t NPCRoster::FindSlot(RE::FormID npcFormID) const {
+        auto it = std::lower_bound(index_.begin(), index_.end(), npcFormID, SlotEntryLess);
+        return (it != index_.end() && it->first == npcFormID) ? it->second : kInvalidPos;
+    }
+
+    NPCRelationshipData* NPCRoster::Find(RE::FormID npcFormID) {
+        auto slot = FindSlot(npcFormID);
+        return slot != kInvalidPos ? &records_[slot] : nullptr;
+    }
+
+    const NPCRelationshipData* NPCRoster::Find(RE::FormID npcFormID) const {
+        auto slot = FindSlot(npcFormID);
+        return slot != kInvalidPos ? &records_[slot] : nullptr;
+    }
+
+    NPCRelationshipData* NPCRoster::Insert(NPCRelationshipData data) {
+        const RE::FormID npcFormID = data.formID;
+        if (npcFormID == 0) {
+            return nullptr;
+        }
+
+        auto it = std::lower_bound(index_.begin(), index_.end(), npcFormID, SlotEntryLess);
+        if (it != index_.end() && it->first == npcFormID) {
+            return nullptr;
+        }
+
+        std::uint32_t slot;
+        if (!freeSlots_.empty()) {
+            slot = freeSlots_.back();
+            freeSlots_.pop_back();
+            records_[slot] = std::move(data);
+            links_[slot] = SlotLinks{};
+        } else {
+            slot = static_cast<std::uint32_t>(records_.size());
+            records_.push_back(std::move(data));
+            links_.emplace_back();
+        }
+
+        index_.insert(it, {npcFormID, slot});
+
+        links_[slot].allPos = static_cast<std::uint32_t>(all_.size());
+        all_.push_back(npcFormID);
+        LinkStatus(slot, records_[slot].status);
+
+        return &records_[slot];
+    }
+
+    bool NPCRoster::Erase(RE::FormID npcFormID) {
+        auto it = std::lower_bound(index_.begin(), index_.end(), npcFormID, SlotEntryLess);
+        if (it == index_.end() || it->first != npcFormID) {
+            return false;
+        }
+
+        const std::uint32_t slot = it->second;
+        UnlinkStatus(slot);
+        SwapRemove(all_, links_[slot].allPos, &SlotLinks::allPos);
+
+        index_.erase(it);
+        records_[slot] = NPCRelationshipData{};
+        links_[slot] = SlotLinks{};
+        freeSlots_.push_back(slot);
+        return true;
+    }
+
+    bool NPCRoster::SetStatus(RE::FormID npcFormID, RelationshipStatus status) {
+        auto slot = FindSlot(npcFormID);
+        if (slot == kInvalidPos) {
+            return false;
+        }
+
+        auto& record = records_[slot];
+        if (record.status == status && (links_[slot].statusPos != kInvalidPos || !IsBucketStatus(status))) {
+            return true;
+        }
+
+        UnlinkStatus(slot);
+        record.status = status;
+        LinkStatus(slot, status);
+        return true;
+    }
+
+    void NPCRoster::Clear() {
+        records_.clear();
+        links_.clear();
+        freeSlots_.clear();
+        index_.clear();
+        all_.clear();
+        for (auto& bucket : byStatus_) {
+            bucket.clear();
+        }
+    }
+
+    void NPCRoster::Reserve(std::size_t count) {
+        records_.reserve(count);
+        links_.reserve(count);
+        index_.reserve(count);
+        all_.reserve(count);
+    }
+
+    std::size_t NPCRoster::CountByStatus(RelationshipStatus status) const {
+        return IsBucketStatus(status) ? byStatus_[static_cast<std::size_t>(status)].size() : 0;
+    }
+
+    const std::vector<RE::FormID>& NPCRoster::ByStatus(RelationshipStatus status) const {
+        static const std::vector<RE::FormID> kEmpty;
+        return IsBucketStatus(status) ? byStatus_[static_cast<std::size_t>(status)] : kEmpty;
+    }
+
+    void NPCRoster::LinkStatus(std::uint32_t slot, RelationshipStatus status) {
+        if (!IsBucketStatus(status)) {
+            links_[slot].statusPos = kInvalidPos;
+            return;
+        }
+
+        auto& bucket = byStatus_[static_cast<std::size_t>(status)];
+        links_[slot].statusPos = static_cast<std::uint32_t>(bucket.size());
+        bucket.push_back(records_[slot].formID);
+    }
+
+    void NPCRoster::UnlinkStatus(std::uint32_t slot) {
+        auto pos = links_[slot].statusPos;
+        auto status = records_[slot].status;
+        if (pos == kInvalidPos || !IsBucketStatus(status)) {
+            return;
+        }
+
+        SwapRemove(byStatus_[static_cast<std::size_t>(status)], pos, &SlotLinks::statusPos);
+        links_[slot].statusPos = kInvalidPos;
+    }
+
+    void NPCRoster::SwapRemove(std::vector<RE::FormID>& dense, std::uint32_t pos, std::uint32_t SlotLinks::*link) {
+        if (pos >= dense.size()) {
+            return;
+        }
+
+        const auto lastPos = static_cast<std::uint32_t>(dense.size() - 1);
+        if (pos != lastPos) {
+            const RE::FormID moved = dense[lastPos];
+            dense[pos] = moved;
+            if (auto movedSlot = FindSlot(moved); movedSlot != kInvalidPos) {
+                links_[movedSlot].*link = pos;
+            }
+        }
+        dense.pop_back();
+    }
+
+}  // namespace MARAS
@@ -1,6 +1,10 @@
 ﻿#include "core/NPCTypeDeterminer.h"
 
 #include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <nlohmann/json.hpp>
 
 #include "core/FormCache.h"
 #include "utils/Common.h"
@@ -8,6 +12,179 @@
 
 namespace MARAS {
 
+    namespace {
+        using TemperamentMatrix = NPCTypeDeterminer::TemperamentMatrix;
+
+        constexpr auto P = Temperament::Proud;
+        constexpr auto H = Temperament::Humble;
+        constexpr auto J = Temperament::Jealous;
+        constexpr auto R = Temperament::Romantic;
+        constexpr auto I = Temperament::Independent;
+
+        // Rows by SocialClass, columns by SkillType: Warrior, Mage, Rogue, Craftsman, Ranger, Orator
+        constexpr TemperamentMatrix kDefaultTemperamentMatrix{{
+            {I, J, J, H, I, R},  // Outcast
+            {H, R, J, I, P, R},  // Poverty
+            {P, H, R, I, I, P},  // Working
+            {P, R, I, R, H, J},  // Middle
+            {P, J, R, R, I, J},  // Wealthy
+            {I, H, R, J, H, P},  // Religious
+            {J, R, I, P, H, P},  // Nobles
+            {P, I, H, R, J, I},  // Rulers
+        }};
+
+        // The rule chain the matrix replaced, kept as the compile-time reference for it
+        constexpr Temperament TemperamentRule(int socialClassIndex, int skillTypeIndex) {
+            // Independent
+            if ((socialClassIndex == 0 && (skillTypeIndex == 0 || skillTypeIndex == 4)) ||
+                (socialClassIndex == 1 && skillTypeIndex == 3) ||
+                (socialClassIndex == 2 && (skillTypeIndex == 3 || skillTypeIndex == 4)) ||
+                (socialClassIndex == 3 && skillTypeIndex == 2) || (socialClassIndex == 4 && skillTypeIndex == 4) ||
+                (socialClassIndex == 5 && skillTypeIndex == 0) || (socialClassIndex == 6 && skillTypeIndex == 2) ||
+                (socialClassIndex == 7 && (skillTypeIndex == 1 || skillTypeIndex == 5))) {
+                return Temperament::Independent;
+            }
+            // Jealous
+            else if ((socialClassIndex == 0 && (skillTypeIndex == 1 || skillTypeIndex == 2)) ||
+                     (socialClassIndex == 1 && skillTypeIndex == 2) || (socialClassIndex == 3 && skillTypeIndex == 5) ||
+                     (socialClassIndex == 4 && (skillTypeIndex == 1 || skillTypeIndex == 5)) ||
+                     (socialClassIndex == 5 && skillTypeIndex == 3) || (socialClassIndex == 6 && skillTypeIndex == 0) ||
+                     (socialClassIndex == 7 && skillTypeIndex == 4)) {
+                return Temperament::Jealous;
+            }
+            // Humble
+            else if ((socialClassIndex == 0 && skillTypeIndex == 3) || (socialClassIndex == 1 && skillTypeIndex == 0) ||
+                     (socialClassIndex == 2 && skillTypeIndex == 1) || (socialClassIndex == 3 && skillTypeIndex == 4) ||
+                     (socialClassIndex == 5 && (skillTypeIndex == 1 || skillTypeIndex == 4)) ||
+                     (socialClassIndex == 6 && skillTypeIndex == 4) || (socialClassIndex == 7 && skillTypeIndex == 2)) {
+                return Temperament::Humble;
+            }
+            // Proud
+            else if ((socialClassIndex == 1 && skillTypeIndex == 4) ||
+                     (socialClassIndex == 2 && (skillTypeIndex == 0 || skillTypeIndex == 5)) ||
+                     (socialClassIndex == 3 && skillTypeIndex == 0) || (socialClassIndex == 4 && skillTypeIndex == 0) ||
+                     (socialClassIndex == 5 && skillTypeIndex == 5) ||
+                     (socialClassIndex == 6 && (skillTypeIndex == 3 || skillTypeIndex == 5)) ||
+                     (socialClassIndex == 7 && skillTypeIndex == 0)) {
+                return Temperament::Proud;
+            }
+            // Romantic
+            else if ((socialClassIndex == 0 && skillTypeIndex == 5) ||
+                     (socialClassIndex == 1 && (skillTypeIndex == 1 || skillTypeIndex == 5)) ||
+                     (socialClassIndex == 2 && skillTypeIndex == 2) ||
+                     (socialClassIndex == 3 && (skillTypeIndex == 1 || skillTypeIndex == 3)) ||
+                     (socialClassIndex == 4 && (skillTypeIndex == 2 || skillTypeIndex == 3)) ||
+                     (socialClassIndex == 5 && skillTypeIndex == 2) || (socialClassIndex == 6 && skillTypeIndex == 1) ||
+                     (socialClassIndex == 7 && skillTypeIndex == 3)) {
+                return Temperament::Romantic;
+            }
+            // Fallback
+            return Temperament::Independent;
+        }
+
+        constexpr bool MatrixMatchesRules(const TemperamentMatrix& matrix) {
+            for (std::size_t sc = 0; sc < matrix.size(); ++sc) {
+                for (std::size_t st = 0; st < matrix[sc].size(); ++st) {
+                    if (matrix[sc][st] != TemperamentRule(static_cast<int>(sc), static_cast<int>(st))) return false;
+                }
+            }
+            return true;
+        }
+        static_assert(MatrixMatchesRules(kDefaultTemperamentMatrix),
+                      "Default temperament matrix must match the temperament rules cell for cell");
+
+        struct SkillInfo {
+            RE::ActorValue value;
+            std::string_view name;
+        };
+
+        // Skill actor values in skill rule order
+        constexpr std::array<SkillInfo, NPCTypeDeterminer::kSkillCount> kSkills{{
+            {RE::ActorValue::kOneHanded, "OneHanded"},     {RE::ActorValue::kTwoHanded, "TwoHanded"},
+            {RE::ActorValue::kArchery, "Archery"},         {RE::ActorValue::kBlock, "Block"},
+            {RE::ActorValue::kSmithing, "Smithing"},       {RE::ActorValue::kHeavyArmor, "HeavyArmor"},
+            {RE::ActorValue::kLightArmor, "LightArmor"},   {RE::ActorValue::kPickpocket, "Pickpocket"},
+            {RE::ActorValue::kLockpicking, "Lockpicking"}, {RE::ActorValue::kSneak, "Sneak"},
+            {RE::ActorValue::kAlchemy, "Alchemy"},         {RE::ActorValue::kSpeech, "Speech"},
+            {RE::ActorValue::kAlteration, "Alteration"},   {RE::ActorValue::kConjuration, "Conjuration"},
+            {RE::ActorValue::kDestruction, "Destruction"}, {RE::ActorValue::kIllusion, "Illusion"},
+            {RE::ActorValue::kRestoration, "Restoration"}, {RE::ActorValue::kEnchanting, "Enchanting"},
+        }};
+        static_assert(kSkills[SkillRules::kArcherySkill].value == RE::ActorValue::kArchery &&
+                          kSkills[SkillRules::kLightArmorSkill].value == RE::ActorValue::kLightArmor &&
+                          kSkills[SkillRules::kPickpocketSkill].value == RE::ActorValue::kPickpocket &&
+                          kSkills[SkillRules::kLockpickingSkill].value == RE::ActorValue::kLockpicking,
+                      "Skill actor values must follow the SkillRules index order");
+
+        std::optional<std::size_t> FindSkill(std::string_view name) {
+            const auto lower = Utils::ToLower(name);
+            for (std::size_t i = 0; i < kSkills.size(); ++i) {
+                if (Utils::ToLower(kSkills[i].name) == lower) return i;
+            }
+            return std::nullopt;
+        }
+
+        constexpr std::string_view SourceName(NPCTypeDeterminer::AttributeSource source) {
+            using Source = NPCTypeDeterminer::AttributeSource;
+            switch (source) {
+                case Source::Faction:
+                    return "faction";
+                case Source::Class:
+                    return "class";
+                case Source::Skills:
+                    return "skills";
+                case Source::Default:
+                    return "default";
+            }
+            return "unknown";
+        }
+
+        // Social class faction lists, each with the class it grants
+        std::array<std::pair<RE::BGSListForm*, SocialClass>, 7> GetSocialClassLists() {
+            auto& cache = FormCache::GetSingleton();
+            return {{{cache.GetRulerFactions(), SocialClass::Rulers},
+                     {cache.GetNobleFactions(), SocialClass::Nobles},
+                     {cache.GetReligiousFactions(), SocialClass::Religious},
+                     {cache.GetWealthyFactions(), SocialClass::Wealthy},
+                     {cache.GetMiddleFactions(), SocialClass::Middle},
+                     {cache.GetPovertyFactions(), SocialClass::Poverty},
+                     {cache.GetOutcastFactions(), SocialClass::Outcast}}};
+        }
+
+        // Class lists in detection order, each with the skill type it grants
+        constexpr std::array<std::pair<FormCache::ListId, SkillType>, 6> kSkillClassLists{{
+            {FormCache::ListId::OratorClasses, SkillType::Orator},
+            {FormCache::ListId::RangerClasses, SkillType::Ranger},
+            {FormCache::ListId::RogueClasses, SkillType::Rogue},
+            {FormCache::ListId::CraftsmanClasses, SkillType::Craftsman},
+            {FormCache::ListId::MageClasses, SkillType::Mage},
+            {FormCache::ListId::WarriorClasses, SkillType::Warrior},
+        }};
+
+        // Case-insensitive match against the enum's display names; nullopt for unknown names
+        template <typename E, typename ToString>
+        std::optional<E> ParseEnum(std::string_view name, ToString toString) {
+            const auto lower = Utils::ToLower(name);
+            for (std::size_t i = 0; i < static_cast<std::size_t>(E::_Count); ++i) {
+                if (Utils::ToLower(toString(static_cast<E>(i))) == lower) return static_cast<E>(i);
+            }
+            return std::nullopt;
+        }
+    }  // namespace
+
+    NPCTypeDeterminer::TemperamentMatrix NPCTypeDeterminer::temperamentMatrix_ = kDefaultTemperamentMatrix;
+    NPCTypeDeterminer::SkillRuleTable NPCTypeDeterminer::skillRules_ = SkillRules::kDefaultSkillRules;
+    std::mutex NPCTypeDeterminer::socialClassIndexMutex_;
+    std::unordered_map<RE::FormID, SocialClass> NPCTypeDeterminer::socialClassByFaction_;
+    std::optional<std::uint64_t> NPCTypeDeterminer::socialClassIndexStamp_;
+    std::optional<std::uint64_t> NPCTypeDeterminer::skillClassListsStamp_;
+    std::mutex NPCTypeDeterminer::baseAttributesMutex_;
+    std::unordered_map<RE::FormID, NPCTypeDeterminer::BaseAttributes> NPCTypeDeterminer::baseAttributes_;
+    std::atomic<std::uint64_t> NPCTypeDeterminer::baseAttributeHits_{0};
+    std::atomic<std::uint64_t> NPCTypeDeterminer::baseAttributeMisses_{0};
+    std::mutex NPCTypeDeterminer::wornClothingMutex_;
+    std::unordered_map<RE::FormID, bool> NPCTypeDeterminer::wornRichClothing_;
+
     // -------------------------- Public API --------------------------
 
     SocialClass NPCTypeDeterminer::DetermineSocialClass(
@@ -19,7 +196,13 @@ namespace MARAS {
                 return result;
             }
         }
-        return DetermineSocialClassByFaction(npcFormID);
+
+        auto actor = RE::TESForm::LookupByID<RE::Actor>(npcFormID);
+        if (!actor) {
+            MARAS_LOG_ERROR("Cannot find actor for FormID {:08X}", npcFormID);
+            return SocialClass::Working;
+        }
+        return DetermineSocialClassByFaction(SnapshotActor(actor));
     }
 
     SkillType NPCTypeDeterminer::DetermineSkillType(
@@ -32,11 +215,99 @@ namespace MARAS {
             }
         }
 
-        // attempt DetermineSkillTypeByClass first (currently mirrors original commented code)
-        if (auto byClass = DetermineSkillTypeByClass(npcFormID); byClass.has_value()) {
-            return byClass.value();
+        auto actor = RE::TESForm::LookupByID<RE::Actor>(npcFormID);
+        if (!actor || !actor->GetActorBase()) {
+            MARAS_LOG_WARN("Cannot find actor or actor base for FormID {:08X}", npcFormID);
+            return SkillType::Warrior;
         }
-        return DetermineSkillTypeBySkills(npcFormID);
+        return DetermineSkillType(SnapshotActor(actor), {});
+    }
+
+    ActorSnapshot NPCTypeDeterminer::SnapshotActor(RE::Actor* actor) {
+        ActorSnapshot snapshot;
+        if (!actor) return snapshot;
+        snapshot.formID = actor->GetFormID();
+        auto* base = actor->GetActorBase();
+        if (!base) return snapshot;
+        snapshot.baseFormID = base->GetFormID();
+        snapshot.cacheableBase = !base->IsDynamicForm();
+
+        // Bring the faction index and the memo up to date with the lists before consulting the memo
+        {
+            std::lock_guard indexLock(socialClassIndexMutex_);
+            RefreshSocialClassIndexLocked();
+            snapshot.classListsStamp = skillClassListsStamp_.value_or(0);
+        }
+        if (snapshot.cacheableBase) {
+            std::lock_guard lock(baseAttributesMutex_);
+            if (auto it = baseAttributes_.find(snapshot.baseFormID); it != baseAttributes_.end()) {
+                baseAttributeHits_.fetch_add(1, std::memory_order_relaxed);
+                snapshot.memoized = it->second;
+            }
+        }
+
+        if (!snapshot.memoized) {
+            snapshot.hasFactions = base->factions.size() > 0;
+            snapshot.factionFormIDs.reserve(base->factions.size());
+            for (const auto& factionInfo : base->factions) {
+                if (factionInfo.faction) snapshot.factionFormIDs.push_back(factionInfo.faction->GetFormID());
+            }
+            if (base->npcClass) snapshot.classFormID = base->npcClass->GetFormID();
+            if (auto actorValueOwner = base->As<RE::ActorValueOwner>()) {
+                snapshot.hasSkills = true;
+                for (std::size_t i = 0; i < kSkillCount; ++i) {
+                    snapshot.skills[i] = actorValueOwner->GetActorValue(kSkills[i].value);
+                }
+            }
+        }
+
+        // Rich clothing only promotes NPCs with factions below Wealthy; skip the equipment scan when the memo
+        // already rules that out
+        bool mayPromote = snapshot.hasFactions;
+        if (snapshot.memoized) {
+            mayPromote = snapshot.memoized->hasFactions &&
+                         snapshot.memoized->factionClass < static_cast<int>(SocialClass::Wealthy);
+        }
+        auto clothingKeyword = FormCache::GetSingleton().GetClothingRichKeyword();
+        if (clothingKeyword && mayPromote) {
+            snapshot.wearsRichClothing = WearsRichClothing(actor, clothingKeyword);
+        }
+        return snapshot;
+    }
+
+    SocialClass NPCTypeDeterminer::DetermineSocialClass(
+        const ActorSnapshot& snapshot,
+        const std::function<std::optional<std::string>(RE::FormID)>& getSocialClassOverride) {
+        if (getSocialClassOverride) {
+            if (auto ov = getSocialClassOverride(snapshot.formID); ov.has_value()) {
+                auto result = Utils::StringToSocialClass(ov.value());
+                MARAS_LOG_DEBUG("Using social class override for {:08X}: {}", snapshot.formID, ov.value());
+                return result;
+            }
+        }
+        return DetermineSocialClassByFaction(snapshot);
+    }
+
+    SkillType NPCTypeDeterminer::DetermineSkillType(
+        const ActorSnapshot& snapshot,
+        const std::function<std::optional<std::string>(RE::FormID)>& getSkillTypeOverride) {
+        if (getSkillTypeOverride) {
+            if (auto ov = getSkillTypeOverride(snapshot.formID); ov.has_value()) {
+                auto result = Utils::StringToSkillType(ov.value());
+                MARAS_LOG_DEBUG("Using skill type override for {:08X}: {}", snapshot.formID, ov.value());
+                return result;
+            }
+        }
+        if (snapshot.baseFormID == 0) {
+            MARAS_LOG_WARN("No actor base captured for FormID {:08X}", snapshot.formID);
+            return SkillType::Warrior;
+        }
+
+        // Class first, then skill values (both taken from the actor base)
+        auto attributes = GetBaseAttributes(snapshot);
+        MARAS_LOG_DEBUG("Skill type for {:08X}: {} (from {})", snapshot.formID,
+                        Utils::SkillTypeToString(attributes.skillType), SourceName(attributes.skillSource));
+        return attributes.skillType;
     }
 
     Temperament NPCTypeDeterminer::DetermineTemperament(
@@ -57,148 +328,155 @@ namespace MARAS {
     }
 
     Temperament NPCTypeDeterminer::ComputeTemperament(SocialClass socialClass, SkillType skillType) {
-        int socialClassIndex = static_cast<int>(socialClass);
-        int skillTypeIndex = static_cast<int>(skillType);
-
-        // Independent
-        if ((socialClassIndex == 0 && (skillTypeIndex == 0 || skillTypeIndex == 4)) ||
-            (socialClassIndex == 1 && skillTypeIndex == 3) ||
-            (socialClassIndex == 2 && (skillTypeIndex == 3 || skillTypeIndex == 4)) ||
-            (socialClassIndex == 3 && skillTypeIndex == 2) || (socialClassIndex == 4 && skillTypeIndex == 4) ||
-            (socialClassIndex == 5 && skillTypeIndex == 0) || (socialClassIndex == 6 && skillTypeIndex == 2) ||
-            (socialClassIndex == 7 && (skillTypeIndex == 1 || skillTypeIndex == 5))) {
-            return Temperament::Independent;
-        }
-        // Jealous
-        else if ((socialClassIndex == 0 && (skillTypeIndex == 1 || skillTypeIndex == 2)) ||
-                 (socialClassIndex == 1 && skillTypeIndex == 2) || (socialClassIndex == 3 && skillTypeIndex == 5) ||
-                 (socialClassIndex == 4 && (skillTypeIndex == 1 || skillTypeIndex == 5)) ||
-                 (socialClassIndex == 5 && skillTypeIndex == 3) || (socialClassIndex == 6 && skillTypeIndex == 0) ||
-                 (socialClassIndex == 7 && skillTypeIndex == 4)) {
-            return Temperament::Jealous;
-        }
-        // Humble
-        else if ((socialClassIndex == 0 && skillTypeIndex == 3) || (socialClassIndex == 1 && skillTypeIndex == 0) ||
-                 (socialClassIndex == 2 && skillTypeIndex == 1) || (socialClassIndex == 3 && skillTypeIndex == 4) ||
-                 (socialClassIndex == 5 && (skillTypeIndex == 1 || skillTypeIndex == 4)) ||
-                 (socialClassIndex == 6 && skillTypeIndex == 4) || (socialClassIndex == 7 && skillTypeIndex == 2)) {
-            return Temperament::Humble;
-        }
-        // Proud
-        else if ((socialClassIndex == 1 && skillTypeIndex == 4) ||
-                 (socialClassIndex == 2 && (skillTypeIndex == 0 || skillTypeIndex == 5)) ||
-                 (socialClassIndex == 3 && skillTypeIndex == 0) || (socialClassIndex == 4 && skillTypeIndex == 0) ||
-                 (socialClassIndex == 5 && skillTypeIndex == 5) ||
-                 (socialClassIndex == 6 && (skillTypeIndex == 3 || skillTypeIndex == 5)) ||
-                 (socialClassIndex == 7 && skillTypeIndex == 0)) {
-            return Temperament::Proud;
-        }
-        // Romantic
-        else if ((socialClassIndex == 0 && skillTypeIndex == 5) ||
-                 (socialClassIndex == 1 && (skillTypeIndex == 1 || skillTypeIndex == 5)) ||
-                 (socialClassIndex == 2 && skillTypeIndex == 2) ||
-                 (socialClassIndex == 3 && (skillTypeIndex == 1 || skillTypeIndex == 3)) ||
-                 (socialClassIndex == 4 && (skillTypeIndex == 2 || skillTypeIndex == 3)) ||
-                 (socialClassIndex == 5 && skillTypeIndex == 2) || (socialClassIndex == 6 && skillTypeIndex == 1) ||
-                 (socialClassIndex == 7 && skillTypeIndex == 3)) {
-            return Temperament::Romantic;
-        }
-        // Fallback
-        else {
+        const auto socialClassIndex = static_cast<std::size_t>(socialClass);
+        const auto skillTypeIndex = static_cast<std::size_t>(skillType);
+        if (socialClassIndex >= kSocialClassCount || skillTypeIndex >= kSkillTypeCount) {
             MARAS_LOG_DEBUG("Temperament matrix fallback (SC:{}, ST:{}), using Independent", socialClassIndex,
                             skillTypeIndex);
             return Temperament::Independent;
         }
+        return temperamentMatrix_[socialClassIndex][skillTypeIndex];
     }
 
-    // -------------------------- Internal Helpers --------------------------
+    bool NPCTypeDeterminer::LoadTemperamentMatrix(const std::string& path) {
+        temperamentMatrix_ = kDefaultTemperamentMatrix;
 
-    SocialClass NPCTypeDeterminer::DetermineSocialClassByFaction(RE::FormID npcFormID) {
-        auto actor = RE::TESForm::LookupByID<RE::Actor>(npcFormID);
-        if (!actor) {
-            MARAS_LOG_ERROR("Cannot find actor for FormID {:08X}", npcFormID);
-            return SocialClass::Working;
+        if (!std::filesystem::exists(path)) {
+            MARAS_LOG_DEBUG("No temperament matrix overrides at {}, using built-in matrix", path);
+            return true;
         }
 
-        auto rulerFactions = FormCache::GetSingleton().GetRulerFactions();
-        auto nobleFactions = FormCache::GetSingleton().GetNobleFactions();
-        auto religiousFactions = FormCache::GetSingleton().GetReligiousFactions();
-        auto wealthyFactions = FormCache::GetSingleton().GetWealthyFactions();
-        auto middleFactions = FormCache::GetSingleton().GetMiddleFactions();
-        auto povertyFactions = FormCache::GetSingleton().GetPovertyFactions();
-        auto outcastFactions = FormCache::GetSingleton().GetOutcastFactions();
+        try {
+            std::ifstream in(path);
+            if (!in.is_open()) {
+                MARAS_LOG_ERROR("Failed to open temperament matrix overrides {}", path);
+                return false;
+            }
 
-        if (!actor->GetActorBase() || !actor->GetActorBase()->factions.size()) {
-            MARAS_LOG_DEBUG("No factions found for actor {:08X}, defaulting to Working class", npcFormID);
-            return SocialClass::Working;
-        }
+            nlohmann::json j;
+            in >> j;
+            if (!j.is_object()) {
+                MARAS_LOG_ERROR("Temperament matrix overrides {} must be a JSON object", path);
+                return false;
+            }
 
-        auto& actorFactions = actor->GetActorBase()->factions;
-        int maxClassIndex = -1;
-
-        for (const auto& factionInfo : actorFactions) {
-            if (!factionInfo.faction) continue;
-            auto faction = factionInfo.faction;
-            if (rulerFactions && rulerFactions->HasForm(faction)) {
-                maxClassIndex = std::max(maxClassIndex, static_cast<int>(SocialClass::Rulers));
-            } else if (nobleFactions && nobleFactions->HasForm(faction)) {
-                maxClassIndex = std::max(maxClassIndex, static_cast<int>(SocialClass::Nobles));
-            } else if (religiousFactions && religiousFactions->HasForm(faction)) {
-                maxClassIndex = std::max(maxClassIndex, static_cast<int>(SocialClass::Religious));
-            } else if (wealthyFactions && wealthyFactions->HasForm(faction)) {
-                maxClassIndex = std::max(maxClassIndex, static_cast<int>(SocialClass::Wealthy));
-            } else if (middleFactions && middleFactions->HasForm(faction)) {
-                maxClassIndex = std::max(maxClassIndex, static_cast<int>(SocialClass::Middle));
-            } else if (povertyFactions && povertyFactions->HasForm(faction)) {
-                maxClassIndex = std::max(maxClassIndex, static_cast<int>(SocialClass::Poverty));
-            } else if (outcastFactions && outcastFactions->HasForm(faction)) {
-                maxClassIndex = std::max(maxClassIndex, static_cast<int>(SocialClass::Outcast));
+            std::size_t applied = 0;
+            for (const auto& [socialName, row] : j.items()) {
+                auto socialClass = ParseEnum<SocialClass>(socialName, Utils::SocialClassToString);
+                if (!socialClass || !row.is_object()) {
+                    MARAS_LOG_WARN("Temperament matrix: ignoring unknown social class '{}'", socialName);
+                    continue;
+                }
+                for (const auto& [skillName, value] : row.items()) {
+                    auto skillType = ParseEnum<SkillType>(skillName, Utils::SkillTypeToString);
+                    std::optional<Temperament> temperament;
+                    if (value.is_string()) {
+                        temperament = ParseEnum<Temperament>(value.get<std::string>(), Utils::TemperamentToString);
+                    }
+                    if (!skillType || !temperament) {
+                        MARAS_LOG_WARN("Temperament matrix: ignoring invalid entry '{}.{}'", socialName, skillName);
+                        continue;
+                    }
+                    temperamentMatrix_[static_cast<std::size_t>(*socialClass)][static_cast<std::size_t>(*skillType)] =
+                        *temperament;
+                    ++applied;
+                }
             }
+
+            MARAS_LOG_INFO("Applied {} temperament matrix overrides from {}", applied, path);
+            return true;
+        } catch (const std::exception& e) {
+            MARAS_LOG_ERROR("Failed to load temperament matrix overrides {}: {}", path, e.what());
+            return false;
+        }
+    }
+
+    bool NPCTypeDeterminer::LoadSkillRules(const std::string& path) {
+        skillRules_ = SkillRules::kDefaultSkillRules;
+        {
+            // Skill types memoized under the previous rules are stale
+            std::lock_guard lock(baseAttributesMutex_);
+            baseAttributes_.clear();
         }
 
-        auto clothingKeyword = FormCache::GetSingleton().GetClothingRichKeyword();
+        if (!std::filesystem::exists(path)) {
+            MARAS_LOG_DEBUG("No skill rule overrides at {}, using built-in rules", path);
+            return true;
+        }
+
+        try {
+            std::ifstream in(path);
+            if (!in.is_open()) {
+                MARAS_LOG_ERROR("Failed to open skill rule overrides {}", path);
+                return false;
+            }
 
-        if (clothingKeyword && maxClassIndex < static_cast<int>(SocialClass::Wealthy)) {
-            using Slot = RE::BGSBipedObjectForm::BipedObjectSlot;
-            const Slot slotsToCheck[] = {Slot::kHead,
-                                         Slot::kHair,
-                                         Slot::kBody,
-                                         Slot::kHands,
-                                         Slot::kForearms,
-                                         Slot::kAmulet,
-                                         Slot::kRing,
-                                         Slot::kFeet,
-                                         Slot::kCalves,
-                                         Slot::kShield,
-                                         Slot::kTail,
-                                         Slot::kLongHair,
-                                         Slot::kCirclet,
-                                         Slot::kEars,
-                                         Slot::kModMouth,
-                                         Slot::kModNeck,
-                                         Slot::kModChestPrimary,
-                                         Slot::kModBack,
-                                         Slot::kModMisc1,
-                                         Slot::kModPelvisPrimary,
-                                         Slot::kModPelvisSecondary,
-                                         Slot::kModLegRight,
-                                         Slot::kModLegLeft,
-                                         Slot::kModFaceJewelry,
-                                         Slot::kModChestSecondary,
-                                         Slot::kModShoulder,
-                                         Slot::kModArmLeft,
-                                         Slot::kModArmRight,
-                                         Slot::kModMisc2};
-
-            for (auto s : slotsToCheck) {
-                if (auto armor = actor->GetWornArmor(s, /*a_noInit=*/true)) {
-                    if (armor->HasKeyword(clothingKeyword)) {
-                        MARAS_LOG_DEBUG("Actor {:08X} is wearing rich clothing keyword; promoting to Wealthy",
-                                        npcFormID);
-                        return SocialClass::Wealthy;
+            nlohmann::json j;
+            in >> j;
+            if (!j.is_object()) {
+                MARAS_LOG_ERROR("Skill rule overrides {} must be a JSON object", path);
+                return false;
+            }
+
+            std::size_t applied = 0;
+            for (const auto& [skillName, value] : j.items()) {
+                auto skill = FindSkill(skillName);
+                if (!skill) {
+                    MARAS_LOG_WARN("Skill rules: ignoring unknown skill '{}'", skillName);
+                    continue;
+                }
+
+                auto rule = skillRules_[*skill];
+                bool valid = true;
+                const auto* typeValue = &value;
+                if (value.is_object()) {
+                    typeValue = value.contains("type") ? &value["type"] : nullptr;
+                    if (value.contains("weight")) {
+                        const auto& weight = value["weight"];
+                        valid = weight.is_number() && std::isfinite(weight.get<float>()) && weight.get<float>() >= 0.0f;
+                        if (valid) rule.weight = weight.get<float>();
+                    }
+                }
+                if (typeValue) {
+                    std::optional<SkillType> type;
+                    if (typeValue->is_string()) {
+                        type = ParseEnum<SkillType>(typeValue->get<std::string>(), Utils::SkillTypeToString);
                     }
+                    valid = valid && type.has_value();
+                    rule.type = type;
                 }
+                if (!valid) {
+                    MARAS_LOG_WARN("Skill rules: ignoring invalid entry '{}'", skillName);
+                    continue;
+                }
+
+                skillRules_[*skill] = rule;
+                ++applied;
             }
+
+            MARAS_LOG_INFO("Applied {} skill rule overrides from {}", applied, path);
+            return true;
+        } catch (const std::exception& e) {
+            MARAS_LOG_ERROR("Failed to load skill rule overrides {}: {}", path, e.what());
+            return false;
+        }
+    }
+
+    // -------------------------- Internal Helpers --------------------------
+
+    SocialClass NPCTypeDeterminer::DetermineSocialClassByFaction(const ActorSnapshot& snapshot) {
+        const auto npcFormID = snapshot.formID;
+        const auto attributes = snapshot.baseFormID ? GetBaseAttributes(snapshot) : BaseAttributes{};
+        if (!attributes.hasFactions) {
+            MARAS_LOG_DEBUG("No factions found for actor {:08X}, defaulting to Working class", npcFormID);
+            return SocialClass::Working;
+        }
+
+        const int maxClassIndex = attributes.factionClass;
+
+        if (maxClassIndex < static_cast<int>(SocialClass::Wealthy) && snapshot.wearsRichClothing) {
+            MARAS_LOG_DEBUG("Actor {:08X} is wearing rich clothing keyword; promoting to Wealthy", npcFormID);
+            return SocialClass::Wealthy;
         }
 
         if (maxClassIndex == -1) {
@@ -211,117 +489,231 @@ namespace MARAS {
         return static_cast<SocialClass>(maxClassIndex);
     }
 
-    std::optional<SkillType> NPCTypeDeterminer::DetermineSkillTypeByClass(RE::FormID npcFormID) {
-        auto actor = RE::TESForm::LookupByID<RE::Actor>(npcFormID);
-        if (!actor || !actor->GetActorBase()) {
-            MARAS_LOG_WARN("Cannot find actor or actor base for FormID {:08X}", npcFormID);
-            return std::nullopt;
+    void NPCTypeDeterminer::BuildSocialClassIndex() {
+        std::lock_guard lock(socialClassIndexMutex_);
+        socialClassIndexStamp_.reset();
+        skillClassListsStamp_.reset();
+        RefreshSocialClassIndexLocked();
+    }
+
+    void NPCTypeDeterminer::RefreshSocialClassIndexLocked() {
+        // Memoized skill types come from the class lists, so a change to any of them invalidates the memo
+        auto& cache = FormCache::GetSingleton();
+        std::uint64_t classStamp = 0;
+        for (const auto& [listId, skillType] : kSkillClassLists) {
+            classStamp = classStamp * 1099511628211ull + FormCache::ListStamp(cache.GetList(listId));
         }
-        auto spouseClass = actor->GetActorBase()->npcClass;
-        if (!spouseClass) {
-            MARAS_LOG_DEBUG("No class found for actor {:08X}", npcFormID);
-            return std::nullopt;
+        if (skillClassListsStamp_ != classStamp) {
+            if (skillClassListsStamp_) {
+                MARAS_LOG_INFO("Skill class lists changed; dropping memoized base attributes");
+            }
+            std::lock_guard lock(baseAttributesMutex_);
+            baseAttributes_.clear();
+            skillClassListsStamp_ = classStamp;
         }
-        auto oratorClasses = FormCache::GetSingleton().GetOratorClasses();
-        auto rangerClasses = FormCache::GetSingleton().GetRangerClasses();
-        auto rogueClasses = FormCache::GetSingleton().GetRogueClasses();
-        auto craftsmanClasses = FormCache::GetSingleton().GetCraftsmanClasses();
-        auto mageClasses = FormCache::GetSingleton().GetMageClasses();
-        auto warriorClasses = FormCache::GetSingleton().GetWarriorClasses();
-        if (oratorClasses && oratorClasses->HasForm(spouseClass)) {
-            MARAS_LOG_DEBUG("Determined skill type by class for {:08X}: Orator", npcFormID);
-            return SkillType::Orator;
-        }
-        if (rangerClasses && rangerClasses->HasForm(spouseClass)) {
-            MARAS_LOG_DEBUG("Determined skill type by class for {:08X}: Ranger", npcFormID);
-            return SkillType::Ranger;
-        }
-        if (rogueClasses && rogueClasses->HasForm(spouseClass)) {
-            MARAS_LOG_DEBUG("Determined skill type by class for {:08X}: Rogue", npcFormID);
-            return SkillType::Rogue;
-        }
-        if (craftsmanClasses && craftsmanClasses->HasForm(spouseClass)) {
-            MARAS_LOG_DEBUG("Determined skill type by class for {:08X}: Craftsman", npcFormID);
-            return SkillType::Craftsman;
-        }
-        if (mageClasses && mageClasses->HasForm(spouseClass)) {
-            MARAS_LOG_DEBUG("Determined skill type by class for {:08X}: Mage", npcFormID);
-            return SkillType::Mage;
-        }
-        if (warriorClasses && warriorClasses->HasForm(spouseClass)) {
-            MARAS_LOG_DEBUG("Determined skill type by class for {:08X}: Warrior", npcFormID);
-            return SkillType::Warrior;
+
+        const auto lists = GetSocialClassLists();
+
+        std::uint64_t stamp = 0;
+        for (const auto& [list, socialClass] : lists) {
+            stamp = stamp * 1099511628211ull + FormCache::ListStamp(list);
         }
-        MARAS_LOG_DEBUG("No class match found for {:08X}, deferring to skill-based detection", npcFormID);
-        return std::nullopt;
+        if (socialClassIndexStamp_ == stamp) return;
+
+        socialClassByFaction_.clear();
+        {
+            std::lock_guard lock(baseAttributesMutex_);
+            baseAttributes_.clear();
+        }
+        auto add = [](RE::FormID factionID, SocialClass socialClass) {
+            auto [it, inserted] = socialClassByFaction_.try_emplace(factionID, socialClass);
+            if (!inserted && it->second < socialClass) it->second = socialClass;
+        };
+        for (const auto& [list, socialClass] : lists) {
+            if (!list) continue;
+            for (auto* form : list->forms) {
+                if (form) add(form->GetFormID(), socialClass);
+            }
+            if (list->scriptAddedTempForms) {
+                for (auto formID : *list->scriptAddedTempForms) add(formID, socialClass);
+            }
+        }
+
+        // A rebuild after data load means scripts changed a list
+        if (socialClassIndexStamp_) {
+            MARAS_LOG_INFO("Social class faction lists changed; rebuilt index with {} factions",
+                           socialClassByFaction_.size());
+        } else {
+            MARAS_LOG_INFO("Built social class index for {} factions", socialClassByFaction_.size());
+        }
+        socialClassIndexStamp_ = stamp;
     }
 
-    SkillType NPCTypeDeterminer::DetermineSkillTypeBySkills(RE::FormID npcFormID) {
-        auto actor = RE::TESForm::LookupByID<RE::Actor>(npcFormID);
-        if (!actor) {
-            MARAS_LOG_WARN("Cannot find actor for FormID {:08X} in skill determination", npcFormID);
-            return SkillType::Warrior;
+    NPCTypeDeterminer::BaseAttributes NPCTypeDeterminer::GetBaseAttributes(const ActorSnapshot& snapshot) {
+        if (snapshot.memoized) return *snapshot.memoized;
+
+        // Another snapshot of the same base may have been classified since this one was taken
+        const auto baseID = snapshot.baseFormID;
+        if (snapshot.cacheableBase) {
+            std::lock_guard lock(baseAttributesMutex_);
+            if (auto it = baseAttributes_.find(baseID); it != baseAttributes_.end()) {
+                baseAttributeHits_.fetch_add(1, std::memory_order_relaxed);
+                return it->second;
+            }
         }
-        std::array<float, 18> skills{};
-        auto actorValueOwner = actor->GetActorBase()->As<RE::ActorValueOwner>();
-        if (!actorValueOwner) {
-            MARAS_LOG_WARN("Actor {:08X} does not implement ActorValueOwner interface (actor or base)", npcFormID);
-            return SkillType::Warrior;
+
+        BaseAttributes attributes;
+        if (auto byClass = DetermineSkillTypeByClass(baseID, snapshot.classFormID); byClass.has_value()) {
+            attributes.skillType = byClass.value();
+            attributes.skillSource = AttributeSource::Class;
+        } else if (snapshot.hasSkills) {
+            attributes.skillType = DetermineSkillTypeBySkills(baseID, snapshot.skills);
+            attributes.skillSource = AttributeSource::Skills;
+        } else {
+            MARAS_LOG_WARN("Actor base {:08X} does not implement ActorValueOwner interface", baseID);
         }
-        skills[0] = actorValueOwner->GetActorValue(RE::ActorValue::kOneHanded);
-        skills[1] = actorValueOwner->GetActorValue(RE::ActorValue::kTwoHanded);
-        skills[2] = actorValueOwner->GetActorValue(RE::ActorValue::kArchery);
-        skills[3] = actorValueOwner->GetActorValue(RE::ActorValue::kBlock);
-        skills[4] = actorValueOwner->GetActorValue(RE::ActorValue::kSmithing);
-        skills[5] = actorValueOwner->GetActorValue(RE::ActorValue::kHeavyArmor);
-        skills[6] = actorValueOwner->GetActorValue(RE::ActorValue::kLightArmor);
-        skills[7] = actorValueOwner->GetActorValue(RE::ActorValue::kPickpocket);
-        skills[8] = actorValueOwner->GetActorValue(RE::ActorValue::kLockpicking);
-        skills[9] = actorValueOwner->GetActorValue(RE::ActorValue::kSneak);
-        skills[10] = actorValueOwner->GetActorValue(RE::ActorValue::kAlchemy);
-        skills[11] = actorValueOwner->GetActorValue(RE::ActorValue::kSpeech);
-        skills[12] = actorValueOwner->GetActorValue(RE::ActorValue::kAlteration);
-        skills[13] = actorValueOwner->GetActorValue(RE::ActorValue::kConjuration);
-        skills[14] = actorValueOwner->GetActorValue(RE::ActorValue::kDestruction);
-        skills[15] = actorValueOwner->GetActorValue(RE::ActorValue::kIllusion);
-        skills[16] = actorValueOwner->GetActorValue(RE::ActorValue::kRestoration);
-        skills[17] = actorValueOwner->GetActorValue(RE::ActorValue::kEnchanting);
-        int maxIndex = 0;
-        float maxVal = skills[0];
-        for (int i = 1; i < 18; ++i) {
-            if (skills[i] > maxVal) {
-                maxIndex = i;
-                maxVal = skills[i];
+
+        // The faction part is read and stored under the index lock, so an index rebuild (which clears this
+        // cache) cannot interleave with it. The index itself was refreshed when the snapshot was taken.
+        std::lock_guard indexLock(socialClassIndexMutex_);
+
+        attributes.hasFactions = snapshot.hasFactions;
+        for (auto factionID : snapshot.factionFormIDs) {
+            auto it = socialClassByFaction_.find(factionID);
+            if (it != socialClassByFaction_.end()) {
+                attributes.factionClass = std::max(attributes.factionClass, static_cast<int>(it->second));
             }
         }
-        if (maxIndex == 0 || maxIndex == 1 || maxIndex == 3 || maxIndex == 5) {
-            MARAS_LOG_DEBUG("Determined skill type by skills for {:08X}: Warrior", npcFormID);
-            return SkillType::Warrior;
-        } else if (maxIndex == 2) {
-            MARAS_LOG_DEBUG("Determined skill type by skills for {:08X}: Ranger", npcFormID);
-            return SkillType::Ranger;
-        } else if (maxIndex == 7 || maxIndex == 8 || maxIndex == 9) {
-            MARAS_LOG_DEBUG("Determined skill type by skills for {:08X}: Rogue", npcFormID);
-            return SkillType::Rogue;
-        } else if (maxIndex == 12 || maxIndex == 13 || maxIndex == 14 || maxIndex == 15 || maxIndex == 16) {
-            MARAS_LOG_DEBUG("Determined skill type by skills for {:08X}: Mage", npcFormID);
-            return SkillType::Mage;
-        } else if (maxIndex == 11) {
-            MARAS_LOG_DEBUG("Determined skill type by skills for {:08X}: Orator", npcFormID);
-            return SkillType::Orator;
-        } else if (maxIndex == 4 || maxIndex == 10 || maxIndex == 17) {
-            MARAS_LOG_DEBUG("Determined skill type by skills for {:08X}: Craftsman", npcFormID);
-            return SkillType::Craftsman;
-        } else if (maxIndex == 6) {
-            if (skills[2] > skills[7] && skills[2] > skills[8]) {
-                MARAS_LOG_DEBUG("Determined skill type by skills for {:08X}: Ranger (Light Armor case)", npcFormID);
-                return SkillType::Ranger;
-            } else {
-                MARAS_LOG_DEBUG("Determined skill type by skills for {:08X}: Rogue (Light Armor case)", npcFormID);
-                return SkillType::Rogue;
+
+        attributes.socialSource = attributes.factionClass >= 0 ? AttributeSource::Faction : AttributeSource::Default;
+
+        // A class list that changed since the snapshot was taken leaves the skill type stale; return it uncached
+        const auto misses = baseAttributeMisses_.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (snapshot.cacheableBase && skillClassListsStamp_ == snapshot.classListsStamp) {
+            std::lock_guard lock(baseAttributesMutex_);
+            baseAttributes_[baseID] = attributes;
+        }
+        MARAS_LOG_DEBUG(
+            "Determined base attributes for {:08X}: faction class {} (from {}), skill type {} (from {}); cache {} "
+            "hits / {} misses",
+            baseID, attributes.factionClass, SourceName(attributes.socialSource),
+            Utils::SkillTypeToString(attributes.skillType), SourceName(attributes.skillSource),
+            baseAttributeHits_.load(std::memory_order_relaxed), misses);
+        return attributes;
+    }
+
+    bool NPCTypeDeterminer::WearsRichClothing(RE::Actor* actor, RE::BGSKeyword* keyword) {
+        const auto actorID = actor->GetFormID();
+        {
+            std::lock_guard lock(wornClothingMutex_);
+            if (auto it = wornRichClothing_.find(actorID); it != wornRichClothing_.end()) {
+                return it->second;
             }
         }
-        return SkillType::Warrior;  // Fallback
+
+        using Slot = RE::BGSBipedObjectForm::BipedObjectSlot;
+        static constexpr Slot slotsToCheck[] = {Slot::kHead,
+                                                Slot::kHair,
+                                                Slot::kBody,
+                                                Slot::kHands,
+                                                Slot::kForearms,
+                                                Slot::kAmulet,
+                                                Slot::kRing,
+                                                Slot::kFeet,
+                                                Slot::kCalves,
+                                                Slot::kShield,
+                                                Slot::kTail,
+                                                Slot::kLongHair,
+                                                Slot::kCirclet,
+                                                Slot::kEars,
+                                                Slot::kModMouth,
+                                                Slot::kModNeck,
+                                                Slot::kModChestPrimary,
+                                                Slot::kModBack,
+                                                Slot::kModMisc1,
+                                                Slot::kModPelvisPrimary,
+                                                Slot::kModPelvisSecondary,
+                                                Slot::kModLegRight,
+                                                Slot::kModLegLeft,
+                                                Slot::kModFaceJewelry,
+                                                Slot::kModChestSecondary,
+                                                Slot::kModShoulder,
+                                                Slot::kModArmLeft,
+                                                Slot::kModArmRight,
+                                                Slot::kModMisc2};
+
+        bool rich = false;
+        for (auto s : slotsToCheck) {
+            if (auto armor = actor->GetWornArmor(s, /*a_noInit=*/true)) {
+                if (armor->HasKeyword(keyword)) {
+                    rich = true;
+                    break;
+                }
+            }
+        }
+
+        std::lock_guard lock(wornClothingMutex_);
+        wornRichClothing_[actorID] = rich;
+        return rich;
+    }
+
+    void NPCTypeDeterminer::InvalidateWornClothing(RE::FormID actorFormID) {
+        std::lock_guard lock(wornClothingMutex_);
+        wornRichClothing_.erase(actorFormID);
+    }
+
+    void NPCTypeDeterminer::ClearWornClothingCache() {
+        std::lock_guard lock(wornClothingMutex_);
+        wornRichClothing_.clear();
+    }
+
+    std::optional<SkillType> NPCTypeDeterminer::DetermineSkillTypeByClass(RE::FormID baseFormID,
+                                                                          RE::FormID classID) {
+        if (classID == 0) {
+            MARAS_LOG_DEBUG("No class found for actor base {:08X}", baseFormID);
+            return std::nullopt;
+        }
+        auto& cache = FormCache::GetSingleton();
+        for (const auto& [listId, skillType] : kSkillClassLists) {
+            if (cache.ContainsFast(listId, classID)) {
+                MARAS_LOG_DEBUG("Determined skill type by class for {:08X}: {}", baseFormID,
+                                Utils::SkillTypeToString(skillType));
+                return skillType;
+            }
+        }
+        MARAS_LOG_DEBUG("No class match found for {:08X}, deferring to skill-based detection", baseFormID);
+        return std::nullopt;
+    }
+
+    SkillType NPCTypeDeterminer::DetermineSkillTypeBySkills(RE::FormID baseFormID,
+                                                            const std::array<float, kSkillCount>& skills) {
+        const auto pick = SkillRules::PickSkillType(skills, skillRules_);
+        MARAS_LOG_DEBUG("Determined skill type by skills for {:08X}: {} (top skill {})", baseFormID,
+                        Utils::SkillTypeToString(pick.type), kSkills[pick.topSkill].name);
+        return pick.type;
+    }
+
+    // -------------------------- Worn equipment events --------------------------
+
+    WornEquipmentEventSink* WornEquipmentEventSink::GetSingleton() {
+        static WornEquipmentEventSink singleton;
+        return &singleton;
+    }
+
+    RE::BSEventNotifyControl WornEquipmentEventSink::ProcessEvent(const RE::TESEquipEvent* event,
+                                                                  RE::BSTEventSource<RE::TESEquipEvent>*) {
+        if (event && event->actor) {
+            NPCTypeDeterminer::InvalidateWornClothing(event->actor->GetFormID());
+        }
+        return RE::BSEventNotifyControl::kContinue;
+    }
+
+    RE::BSEventNotifyControl WornEquipmentEventSink::ProcessEvent(const RE::TESObjectLoadedEvent* event,
+                                                                  RE::BSTEventSource<RE::TESObjectLoadedEvent>*) {
+        if (event && event->formID) {
+            NPCTypeDeterminer::InvalidateWornClothing(event->formID);
+        }
+        return RE::BSEventNotifyControl::kContinue;
     }
 
 }  // namespace MARAS
@@ -6,6 +6,7 @@
 
 #include "RE/A/AIProcess.h"
 #include "core/AffectionService.h"
+#include "core/FrameScheduler.h"
 #include "core/NPCRelationshipManager.h"
 #include "utils/Common.h"
 
@@ -17,15 +18,16 @@ namespace MARAS {
     }
 
     void PollingService::Initialize() {
-        auto now = std::chrono::steady_clock::now();
-        lastTeammateCheck_ = now;
-        lastDayCheck_ = now;
-
         // Initialize/reset state to current values to prevent false change events
+        {
+            std::lock_guard lock(candidatesMutex_);
+            teammateCandidates_.clear();
+        }
         previousTeammates_ = GetCurrentTeammates();
         previousGameDay_ = GetCurrentGameDay();
 
         if (!initialized_) {
+            ScheduleJobs();
             initialized_ = true;
             MARAS_LOG_INFO("PollingService initialized");
         } else {
@@ -36,31 +38,35 @@ namespace MARAS {
     void PollingService::Shutdown() {
         if (!initialized_) return;
 
+        auto& scheduler = FrameScheduler::GetSingleton();
+        scheduler.Cancel("polling.teammateEvents");
+        scheduler.Cancel("polling.flushGlobals");
+        scheduler.Cancel("polling.teammateReconcile");
+        scheduler.Cancel("polling.dayCheck");
+
         previousTeammates_.clear();
+        {
+            std::lock_guard lock(candidatesMutex_);
+            teammateCandidates_.clear();
+        }
         initialized_ = false;
         MARAS_LOG_INFO("PollingService shutdown");
     }
 
-    void PollingService::Update() {
-        if (!initialized_) return;
-        if (RE::UI::GetSingleton()->GameIsPaused()) {
-            MARAS_LOG_DEBUG("Game is paused; skipping PollingService update");
-            return;
-        }
+    void PollingService::ScheduleJobs() {
+        auto& scheduler = FrameScheduler::GetSingleton();
 
-        auto now = std::chrono::steady_clock::now();
+        // Re-evaluate actors flagged by package/load events
+        scheduler.Schedule("polling.teammateEvents", kTeammateEventInterval, [this] { ProcessTeammateCandidates(); });
 
-        // Check teammates every 15 seconds
-        if (now - lastTeammateCheck_ >= kTeammateCheckInterval) {
-            CheckTeammateChanges();
-            lastTeammateCheck_ = now;
-        }
+        // Push any relationship counter changes that are still pending to the TT_MARAS globals
+        scheduler.Schedule("polling.flushGlobals", kGlobalsFlushInterval,
+                           [] { NPCRelationshipManager::GetSingleton().FlushGlobals(); });
 
-        // Check day change every 60 seconds
-        if (now - lastDayCheck_ >= kDayCheckInterval) {
-            CheckDayChanged();
-            lastDayCheck_ = now;
-        }
+        // Reconcile against a full ProcessLists scan, and check for a new game day
+        scheduler.Schedule("polling.teammateReconcile", kTeammateCheckInterval, [this] { CheckTeammateChanges(); },
+                           kSlowJobJitter);
+        scheduler.Schedule("polling.dayCheck", kDayCheckInterval, [this] { CheckDayChanged(); }, kSlowJobJitter);
     }
 
     void PollingService::CheckTeammateChanges() {
@@ -84,9 +90,9 @@ namespace MARAS {
             }
         }
 
-        // Send event if there are changes
+        // Send event if there are changes (events should have caught these already)
         if (!added.empty() || !removed.empty()) {
-            MARAS_LOG_INFO("Teammate changes detected: {} added, {} removed", added.size(), removed.size());
+            MARAS_LOG_INFO("Teammate reconciliation found {} added, {} removed", added.size(), removed.size());
             SendTeammateChangeEvent(added, removed);
             previousTeammates_ = std::move(currentTeammates);
         }
@@ -99,10 +105,9 @@ namespace MARAS {
         if (static_cast<int>(currentDay) != static_cast<int>(previousGameDay_)) {
             MARAS_LOG_INFO("Game day changed: {} -> {}", previousGameDay_, currentDay);
 
-            // Notify AffectionService to process decay
-            AffectionService::GetSingleton().OnDayChanged();
-
-            SendDayChangeEvent(currentDay);
+            // Notify AffectionService to process decay; the decay pass is spread over several frames and the
+            // day change event goes out once it has finished, so Papyrus applies the day's affection after it
+            AffectionService::GetSingleton().OnDayChanged([this, currentDay] { SendDayChangeEvent(currentDay); });
             previousGameDay_ = currentDay;
         }
     }
@@ -122,13 +127,13 @@ namespace MARAS {
 
             // Native teammate flag
             if (actor->IsPlayerTeammate()) {
-                MARAS_LOG_INFO("Actor {:08X} is a native teammate", actor->GetFormID());
+                MARAS_LOG_DEBUG("Actor {:08X} is a native teammate", actor->GetFormID());
                 isTeammate = true;
             }
 
             // Check CurrentFollowerFaction
             if (!isTeammate && currentFollowerFaction && actor->IsInFaction(currentFollowerFaction)) {
-                MARAS_LOG_INFO("Actor {:08X} is in CurrentFollowerFaction", actor->GetFormID());
+                MARAS_LOG_DEBUG("Actor {:08X} is in CurrentFollowerFaction", actor->GetFormID());
                 isTeammate = true;
             }
 
@@ -136,7 +141,7 @@ namespace MARAS {
             if (!isTeammate) {
                 if (auto* pkg = actor->GetCurrentPackage()) {
                     if (pkg->packData.packType == RE::PACKAGE_TYPE::kFollow) {
-                        MARAS_LOG_INFO("Actor {:08X} is following player via package", actor->GetFormID());
+                        MARAS_LOG_DEBUG("Actor {:08X} is following player via package", actor->GetFormID());
                         isTeammate = true;
                     }
                 }
@@ -145,9 +150,9 @@ namespace MARAS {
                     // Only consider as teammate if the actor's follow target is the player
                     if (auto targetRef = RE::TESObjectREFR::LookupByHandle(ai->followTarget)) {
                         if (!targetRef) {
-                            MARAS_LOG_INFO("Actor {:08X} follow target is null", actor->GetFormID());
+                            MARAS_LOG_DEBUG("Actor {:08X} follow target is null", actor->GetFormID());
                         } else if (targetRef.get() == player) {
-                            MARAS_LOG_INFO("Actor {:08X} is following player via AI state", actor->GetFormID());
+                            MARAS_LOG_DEBUG("Actor {:08X} is following player via AI state", actor->GetFormID());
                             isTeammate = true;
                         }
                     }
@@ -191,6 +196,46 @@ namespace MARAS {
         return teammates;
     }
 
+    void PollingService::MarkTeammateCandidate(FormID formID) {
+        if (formID == 0) return;
+        std::lock_guard lock(candidatesMutex_);
+        teammateCandidates_.insert(formID);
+    }
+
+    void PollingService::ProcessTeammateCandidates() {
+        std::unordered_set<FormID> candidates;
+        {
+            std::lock_guard lock(candidatesMutex_);
+            if (teammateCandidates_.empty()) return;
+            candidates.swap(teammateCandidates_);
+        }
+
+        auto& manager = NPCRelationshipManager::GetSingleton();
+
+        std::unordered_set<FormID> added;
+        std::unordered_set<FormID> removed;
+        for (auto formID : candidates) {
+            if (!manager.IsRegistered(formID)) continue;
+
+            auto* actor = RE::TESForm::LookupByID<RE::Actor>(formID);
+            bool isTeammate = actor && actor->Is3DLoaded() && !actor->IsDeleted() && CheckIsTeammate(actor);
+            bool wasTeammate = previousTeammates_.contains(formID);
+
+            if (isTeammate && !wasTeammate) {
+                added.insert(formID);
+                previousTeammates_.insert(formID);
+            } else if (!isTeammate && wasTeammate) {
+                removed.insert(formID);
+                previousTeammates_.erase(formID);
+            }
+        }
+
+        if (!added.empty() || !removed.empty()) {
+            MARAS_LOG_INFO("Teammate changes detected: {} added, {} removed", added.size(), removed.size());
+            SendTeammateChangeEvent(added, removed);
+        }
+    }
+
     bool PollingService::IsPlayerTeammate(RE::Actor* actor) {
         if (!actor) {
             MARAS_LOG_WARN("IsPlayerTeammate: null actor provided");
@@ -269,4 +314,37 @@ namespace MARAS {
         MARAS_LOG_INFO("Sent maras_day_changed event for day {}", newDay);
     }
 
+    // ========================================
+    // Teammate Event Sink
+    // ========================================
+
+    TeammateEventSink* TeammateEventSink::GetSingleton() {
+        static TeammateEventSink singleton;
+        return &singleton;
+    }
+
+    RE::BSEventNotifyControl TeammateEventSink::ProcessEvent(const RE::TESPackageEvent* event,
+                                                             RE::BSTEventSource<RE::TESPackageEvent>*) {
+        if (!event || !event->actor || !event->actor->Is(RE::FormType::ActorCharacter)) {
+            return RE::BSEventNotifyControl::kContinue;
+        }
+
+        PollingService::GetSingleton().MarkTeammateCandidate(event->actor->GetFormID());
+        return RE::BSEventNotifyControl::kContinue;
+    }
+
+    RE::BSEventNotifyControl TeammateEventSink::ProcessEvent(const RE::TESObjectLoadedEvent* event,
+                                                             RE::BSTEventSource<RE::TESObjectLoadedEvent>*) {
+        if (!event || !event->formID) {
+            return RE::BSEventNotifyControl::kContinue;
+        }
+
+        // Loaded-object events fire for every reference; only actors can be teammates
+        auto* form = RE::TESForm::LookupByID(event->formID);
+        if (form && form->Is(RE::FormType::ActorCharacter)) {
+            PollingService::GetSingleton().MarkTeammateCandidate(event->formID);
+        }
+        return RE::BSEventNotifyControl::kContinue;
+    }
+
 }  // namespace MARAS
@@ -1,6 +1,7 @@
 #include "core/QuestEventHandler.h"
 
 #include "core/AffectionService.h"
+#include "core/MarriageDifficulty.h"
 #include "core/NPCRelationshipManager.h"
 #include "core/QuestEventConfigLoader.h"
 #include "utils/EnumUtils.h"
@@ -74,6 +75,9 @@ namespace MARAS {
 
     void QuestEventManager::ExecuteCommands(const std::vector<QuestCommand>& commands, RE::TESQuest* quest,
                                             const std::string& context) {
+        // Coalesce faction writes, globals and status events across the whole command list
+        StatusTransitionBatch batch;
+
         for (const auto& command : commands) {
             if (!ExecuteCommand(command, quest, context)) {
                 MARAS_LOG_WARN("Failed to execute command '{}:{}:{}' in context '{}' for quest 0x{:08X}",
@@ -464,6 +468,9 @@ namespace MARAS {
             return RE::BSEventNotifyControl::kContinue;
         }
 
+        // Thane, guild and main quest progress feed the cached player standing used for marriage chances
+        MarriageDifficulty::OnQuestStageChanged(event->formID);
+
         auto* quest = RE::TESForm::LookupByID<RE::TESQuest>(event->formID);
         if (!quest) {
             return RE::BSEventNotifyControl::kContinue;
@@ -0,0 +1,26 @@
+#include "core/SkillRules.h"
+
+namespace MARAS::SkillRules {
+
+    SkillPick PickSkillType(const SkillLevels& skills, const SkillRuleTable& rules) {
+        SkillPick pick;
+        float topScore = skills[0] * rules[0].weight;
+        for (std::size_t i = 1; i < kSkillCount; ++i) {
+            const float score = skills[i] * rules[i].weight;
+            if (score > topScore) {
+                pick.topSkill = i;
+                topScore = score;
+            }
+        }
+
+        if (const auto& type = rules[pick.topSkill].type; type.has_value()) {
+            pick.type = type.value();
+        } else {
+            const bool archeryLeads =
+                skills[kArcherySkill] > skills[kPickpocketSkill] && skills[kArcherySkill] > skills[kLockpickingSkill];
+            pick.type = archeryLeads ? SkillType::Ranger : SkillType::Rogue;
+        }
+        return pick;
+    }
+
+}  // namespace MARAS::SkillRules
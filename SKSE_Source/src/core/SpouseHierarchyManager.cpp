@@ -214,7 +214,7 @@ namespace MARAS {
         // spouses shift up (1->0, 2->1) and the 3rd slot is filled from the
         // remaining married NPCs, if any.
         auto& rel = NPCRelationshipManager::GetSingleton();
-        auto married = rel.GetAllMarried();
+        auto married = rel.ViewByStatus(RelationshipStatus::Married);
 
         // Build candidates: existing top-ranked spouses first (preserve their relative order),
         // then other married NPCs not already present.
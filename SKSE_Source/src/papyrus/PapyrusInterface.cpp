@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <cctype>
 #include <chrono>
+#include <span>
 #include <string>
 
 #include "core/AffectionService.h"
@@ -74,6 +75,31 @@ namespace MARAS::PapyrusInterface {
         return result;
     }
 
+    std::vector<std::int32_t> RegisterCandidates(RE::StaticFunctionTag*, std::vector<RE::Actor*> npcs) {
+        auto results = NPCRelationshipManager::GetSingleton().RegisterCandidates(npcs);
+
+        std::vector<std::int32_t> codes;
+        codes.reserve(results.size());
+        for (auto result : results) {
+            codes.push_back(static_cast<std::int32_t>(result));
+        }
+        return codes;
+    }
+
+    std::vector<RE::Actor*> RegisterLoadedCandidates(RE::StaticFunctionTag*) {
+        auto& manager = NPCRelationshipManager::GetSingleton();
+        auto actors = manager.CollectLoadedCandidates();
+        auto results = manager.RegisterCandidates(actors);
+
+        std::vector<RE::Actor*> registered;
+        for (std::size_t i = 0; i < actors.size(); ++i) {
+            if (results[i] == NPCRelationshipManager::BulkRegisterResult::Registered) {
+                registered.push_back(actors[i]);
+            }
+        }
+        return registered;
+    }
+
     bool UnregisterNPC(RE::StaticFunctionTag*, RE::Actor* npc) {
         if (!npc) {
             MARAS_LOG_WARN("UnregisterNPC: null actor provided");
@@ -241,12 +267,28 @@ namespace MARAS::PapyrusInterface {
         }
     }
 
+    std::int32_t PromoteNPCsToStatus(RE::StaticFunctionTag* tag, std::vector<RE::Actor*> npcs,
+                                     std::string statusType) {
+        std::int32_t promoted = 0;
+
+        // One faction/globals/event flush for the whole array
+        StatusTransitionBatch batch;
+        for (auto npc : npcs) {
+            if (PromoteNPCToStatus(tag, npc, statusType)) {
+                ++promoted;
+            }
+        }
+
+        MARAS_LOG_INFO("PromoteNPCsToStatus: promoted {} of {} NPCs to '{}'", promoted, npcs.size(), statusType);
+        return promoted;
+    }
+
     // ========================================
     // Consolidated bulk retrieval
     // ========================================
 
-    // Helper function to convert FormID vector to Actor array
-    std::vector<RE::Actor*> ConvertFormIDsToActors(const std::vector<RE::FormID>& formIDs) {
+    // Helper function to convert a FormID view to an Actor array in a single pass
+    std::vector<RE::Actor*> ConvertFormIDsToActors(std::span<const RE::FormID> formIDs) {
         std::vector<RE::Actor*> actors;
         actors.reserve(formIDs.size());
 
@@ -267,24 +309,11 @@ namespace MARAS::PapyrusInterface {
 
         // Special case for "all"
         if (lower == "all") {
-            return ConvertFormIDsToActors(manager.GetAllRegisteredNPCs());
+            return ConvertFormIDsToActors(manager.ViewAllRegistered());
         }
 
         auto status = Utils::StringToRelationshipStatus(statusType);
-        switch (status) {
-            case RelationshipStatus::Candidate:
-                return ConvertFormIDsToActors(manager.GetAllCandidates());
-            case RelationshipStatus::Engaged:
-                return ConvertFormIDsToActors(manager.GetAllEngaged());
-            case RelationshipStatus::Married:
-                return ConvertFormIDsToActors(manager.GetAllMarried());
-            case RelationshipStatus::Divorced:
-                return ConvertFormIDsToActors(manager.GetAllDivorced());
-            case RelationshipStatus::Jilted:
-                return ConvertFormIDsToActors(manager.GetAllJilted());
-            default:
-                return {};
-        }
+        return ConvertFormIDsToActors(manager.ViewByStatus(status));
     }
 
     std::vector<RE::Actor*> GetNPCsByStatusEnum(RE::StaticFunctionTag*, std::int32_t statusEnum) {
@@ -292,7 +321,7 @@ namespace MARAS::PapyrusInterface {
 
         // Special case for -1 = "all"
         if (statusEnum == -1) {
-            return ConvertFormIDsToActors(manager.GetAllRegisteredNPCs());
+            return ConvertFormIDsToActors(manager.ViewAllRegistered());
         }
 
         if (statusEnum < 0 || statusEnum > 4) {
@@ -300,20 +329,7 @@ namespace MARAS::PapyrusInterface {
             return {};
         }
 
-        switch (static_cast<RelationshipStatus>(statusEnum)) {
-            case RelationshipStatus::Candidate:
-                return ConvertFormIDsToActors(manager.GetAllCandidates());
-            case RelationshipStatus::Engaged:
-                return ConvertFormIDsToActors(manager.GetAllEngaged());
-            case RelationshipStatus::Married:
-                return ConvertFormIDsToActors(manager.GetAllMarried());
-            case RelationshipStatus::Divorced:
-                return ConvertFormIDsToActors(manager.GetAllDivorced());
-            case RelationshipStatus::Jilted:
-                return ConvertFormIDsToActors(manager.GetAllJilted());
-            default:
-                return {};
-        }
+        return ConvertFormIDsToActors(manager.ViewByStatus(static_cast<RelationshipStatus>(statusEnum)));
     }
 
     // Returns the currently-detected teammates (actors following the player or flagged as teammates)
@@ -356,20 +372,7 @@ namespace MARAS::PapyrusInterface {
         }
 
         auto status = Utils::StringToRelationshipStatus(statusType);
-        switch (status) {
-            case RelationshipStatus::Candidate:
-                return static_cast<int>(manager.GetCandidateCount());
-            case RelationshipStatus::Engaged:
-                return static_cast<int>(manager.GetEngagedCount());
-            case RelationshipStatus::Married:
-                return static_cast<int>(manager.GetMarriedCount());
-            case RelationshipStatus::Divorced:
-                return static_cast<int>(manager.GetDivorcedCount());
-            case RelationshipStatus::Jilted:
-                return static_cast<int>(manager.GetJiltedCount());
-            default:
-                return 0;
-        }
+        return static_cast<int>(manager.GetCountByStatus(status));
     }
 
     int GetStatusCountByEnum(RE::StaticFunctionTag*, std::int32_t statusEnum) {
@@ -385,20 +388,7 @@ namespace MARAS::PapyrusInterface {
             return 0;
         }
 
-        switch (static_cast<RelationshipStatus>(statusEnum)) {
-            case RelationshipStatus::Candidate:
-                return static_cast<int>(manager.GetCandidateCount());
-            case RelationshipStatus::Engaged:
-                return static_cast<int>(manager.GetEngagedCount());
-            case RelationshipStatus::Married:
-                return static_cast<int>(manager.GetMarriedCount());
-            case RelationshipStatus::Divorced:
-                return static_cast<int>(manager.GetDivorcedCount());
-            case RelationshipStatus::Jilted:
-                return static_cast<int>(manager.GetJiltedCount());
-            default:
-                return 0;
-        }
+        return static_cast<int>(manager.GetCountByStatus(static_cast<RelationshipStatus>(statusEnum)));
     }
 
     // ========================================
@@ -487,6 +477,16 @@ namespace MARAS::PapyrusInterface {
                                                                   dragonSoulsCollected, playerKiller);
     }
 
+    std::vector<float> CalculateMarriageSuccessChances(RE::StaticFunctionTag*, std::vector<RE::Actor*> npcs,
+                                                       std::vector<float> intimacyAdjustments, float mostGold,
+                                                       float housesOwned, float horsesOwned, float questsCompleted,
+                                                       float dungeonsCleared, float dragonSoulsCollected,
+                                                       bool playerKiller) {
+        return MarriageDifficulty::CalculateMarriageSuccessChances(npcs, intimacyAdjustments, mostGold, housesOwned,
+                                                                   horsesOwned, questsCompleted, dungeonsCleared,
+                                                                   dragonSoulsCollected, playerKiller);
+    }
+
     // ========================================
     // Spouse buff/service bindings
     // ========================================
@@ -1055,6 +1055,8 @@ namespace MARAS::PapyrusInterface {
         // Core registration functions
         vm->RegisterFunction("RegisterCandidate", "MARAS", RegisterCandidate);
         vm->RegisterFunction("UnregisterNPC", "MARAS", UnregisterNPC);
+        vm->RegisterFunction("RegisterCandidates", "MARAS", RegisterCandidates);
+        vm->RegisterFunction("RegisterLoadedCandidates", "MARAS", RegisterLoadedCandidates);
 
         // Consolidated faction management functions
         vm->RegisterFunction("SetNpcCharacteristics", "MARAS", SetNpcCharacteristics);
@@ -1066,6 +1068,7 @@ namespace MARAS::PapyrusInterface {
         // Consolidated status transition functions
         vm->RegisterFunction("PromoteNPCToStatus", "MARAS", PromoteNPCToStatus);
         vm->RegisterFunction("PromoteNPCToStatusByEnum", "MARAS", PromoteNPCToStatusByEnum);
+        vm->RegisterFunction("PromoteNPCsToStatus", "MARAS", PromoteNPCsToStatus);
 
         // Consolidated bulk retrieval functions
         vm->RegisterFunction("GetNPCsByStatus", "MARAS", GetNPCsByStatus);
@@ -1086,6 +1089,7 @@ namespace MARAS::PapyrusInterface {
 
         // Marriage difficulty calculation
         vm->RegisterFunction("CalculateMarriageSuccessChance", "MARAS", CalculateMarriageSuccessChance);
+        vm->RegisterFunction("CalculateMarriageSuccessChances", "MARAS", CalculateMarriageSuccessChances);
 
         // Spouse hierarchy
         vm->RegisterFunction("SetHierarchyRank", "MARAS", SetHierarchyRank);
@@ -0,0 +1,147 @@
+// Golden vectors for skill-based skill type detection: tie breaking, the Light Armor rule and rule tables as
+// LoadSkillRules builds them from skillRules.json overrides.
+
+#include <cstdio>
+#include <initializer_list>
+#include <utility>
+
+#include "TestCheck.h"
+#include "core/SkillRules.h"
+
+namespace {
+
+    using namespace MARAS;
+    using namespace MARAS::SkillRules;
+
+    // Skill indices in rule order, for readable vectors
+    enum Skill : std::size_t {
+        OneHanded,
+        TwoHanded,
+        Archery,
+        Block,
+        Smithing,
+        HeavyArmor,
+        LightArmor,
+        Pickpocket,
+        Lockpicking,
+        Sneak,
+        Alchemy,
+        Speech,
+        Alteration,
+        Conjuration,
+        Destruction,
+        Illusion,
+        Restoration,
+        Enchanting,
+    };
+    static_assert(Archery == kArcherySkill && LightArmor == kLightArmorSkill && Pickpocket == kPickpocketSkill &&
+                  Lockpicking == kLockpickingSkill);
+
+    SkillLevels Levels(std::initializer_list<std::pair<Skill, float>> values) {
+        SkillLevels levels{};
+        for (const auto& [skill, level] : values) levels[skill] = level;
+        return levels;
+    }
+
+    struct GoldenCase {
+        const char* name;
+        SkillLevels levels;
+        std::size_t topSkill;
+        SkillType type;
+    };
+
+    void Check(const GoldenCase& test, const SkillRuleTable& rules) {
+        const auto pick = PickSkillType(test.levels, rules);
+        MARAS_CHECK(pick.topSkill == test.topSkill, "%s: top skill %zu, expected %zu", test.name, pick.topSkill,
+                    test.topSkill);
+        MARAS_CHECK(pick.type == test.type, "%s: skill type %d, expected %d", test.name, static_cast<int>(pick.type),
+                    static_cast<int>(test.type));
+    }
+
+    void TestDefaultRules() {
+        const GoldenCase cases[] = {
+            {"all zero: first skill wins", Levels({}), OneHanded, SkillType::Warrior},
+            {"clear top skill", Levels({{Illusion, 80}, {OneHanded, 40}}), Illusion, SkillType::Mage},
+            {"tie: earlier skill wins", Levels({{Destruction, 50}, {OneHanded, 50}}), OneHanded, SkillType::Warrior},
+            {"tie: Speech before Destruction", Levels({{Destruction, 50}, {Speech, 50}}), Speech, SkillType::Orator},
+            {"tie: Archery before Light Armor", Levels({{Archery, 70}, {LightArmor, 70}}), Archery,
+             SkillType::Ranger},
+            {"Light Armor, Archery beats both", Levels({{LightArmor, 90}, {Archery, 60}, {Pickpocket, 40},
+                                                        {Lockpicking, 50}}),
+             LightArmor, SkillType::Ranger},
+            {"Light Armor, Archery ties Pickpocket", Levels({{LightArmor, 90}, {Archery, 60}, {Pickpocket, 60}}),
+             LightArmor, SkillType::Rogue},
+            {"Light Armor, Lockpicking beats Archery", Levels({{LightArmor, 90}, {Archery, 60}, {Lockpicking, 70}}),
+             LightArmor, SkillType::Rogue},
+            {"Light Armor alone", Levels({{LightArmor, 30}}), LightArmor, SkillType::Rogue},
+        };
+        for (const auto& test : cases) Check(test, kDefaultSkillRules);
+    }
+
+    void TestOverriddenRules() {
+        // {"Speech": {"weight": 2.0}}
+        auto speechWeighted = kDefaultSkillRules;
+        speechWeighted[Speech].weight = 2.0f;
+        Check({"Speech weight 2 beats higher One-Handed", Levels({{OneHanded, 50}, {Speech, 30}}), Speech,
+               SkillType::Orator},
+              speechWeighted);
+        Check({"Speech weight 2 ties One-Handed: earlier wins", Levels({{OneHanded, 60}, {Speech, 30}}), OneHanded,
+               SkillType::Warrior},
+              speechWeighted);
+        Check({"same levels under the default rules", Levels({{OneHanded, 50}, {Speech, 30}}), OneHanded,
+               SkillType::Warrior},
+              kDefaultSkillRules);
+
+        // {"LightArmor": {"weight": 0}}
+        auto lightArmorIgnored = kDefaultSkillRules;
+        lightArmorIgnored[LightArmor].weight = 0.0f;
+        Check({"Light Armor weight 0 defers to Sneak", Levels({{LightArmor, 100}, {Sneak, 20}, {Archery, 10}}), Sneak,
+               SkillType::Rogue},
+              lightArmorIgnored);
+
+        // {"LightArmor": "Warrior"}
+        auto lightArmorWarrior = kDefaultSkillRules;
+        lightArmorWarrior[LightArmor].type = SkillType::Warrior;
+        Check({"Light Armor typed Warrior ignores Archery", Levels({{LightArmor, 90}, {Archery, 60}}), LightArmor,
+               SkillType::Warrior},
+              lightArmorWarrior);
+
+        // {"Archery": {"type": "Mage", "weight": 0.5}}
+        auto archeryMage = kDefaultSkillRules;
+        archeryMage[Archery] = {SkillType::Mage, 0.5f};
+        Check({"Archery halved loses to Block", Levels({{Archery, 100}, {Block, 60}}), Block, SkillType::Warrior},
+              archeryMage);
+        Check({"Archery halved still on top", Levels({{Archery, 100}, {Block, 40}}), Archery, SkillType::Mage},
+              archeryMage);
+
+        // {"Archery": {"weight": 0.1}}: the Light Armor rule compares raw levels, not weighted ones
+        auto archeryLight = kDefaultSkillRules;
+        archeryLight[Archery].weight = 0.1f;
+        Check({"Light Armor rule uses raw Archery", Levels({{LightArmor, 100}, {Archery, 60}, {Pickpocket, 50},
+                                                             {Lockpicking, 50}}),
+               LightArmor, SkillType::Ranger},
+              archeryLight);
+
+        // {"Smithing": {"weight": 2.0}}: ties after weighting still go to the earlier skill
+        auto smithingWeighted = kDefaultSkillRules;
+        smithingWeighted[Smithing].weight = 2.0f;
+        Check({"weighted tie: earlier skill wins", Levels({{OneHanded, 40}, {Smithing, 20}}), OneHanded,
+               SkillType::Warrior},
+              smithingWeighted);
+        Check({"weighted tie: Smithing before Enchanting", Levels({{Smithing, 25}, {Enchanting, 50}}), Smithing,
+               SkillType::Craftsman},
+              smithingWeighted);
+    }
+
+}  // namespace
+
+int main() {
+    TestDefaultRules();
+    TestOverriddenRules();
+
+    const int failures = MARAS::Test::FailureCount();
+    if (failures) {
+        std::fprintf(stderr, "%d checks failed\n", failures);
+    }
+    return failures == 0 ? 0 : 1;
+}
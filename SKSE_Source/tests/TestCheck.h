@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdio>
+
+// Minimal assertion helpers for the host tests: failures are printed and counted, and main returns the count.
+namespace MARAS::Test {
+
+    inline int& FailureCount() {
+        static int failures = 0;
+        return failures;
+    }
+
+}  // namespace MARAS::Test
+
+#define MARAS_CHECK(cond, ...)                                                            \
+    do {                                                                                  \
+        if (!(cond)) {                                                                    \
+            std::fprintf(stderr, "%s:%d: check failed: %s: ", __FILE__, __LINE__, #cond); \
+            std::fprintf(stderr, __VA_ARGS__);                                            \
+            std::fprintf(stderr, "\n");                                                   \
+            ++MARAS::Test::FailureCount();                                                \
+        }                                                                                 \
+    } while (false)